@@ -0,0 +1,16 @@
+
+local LalrcActions = PatternPrototype( 'LalrcActions' );
+
+function LalrcActions.created( toolset, target )
+    local lalrc = toolset:interpolate( toolset.settings.lalr.lalrc );
+    target:add_dependency( toolset:Target(lalrc) );
+end
+
+function LalrcActions.build( toolset, target )
+    local lalrc = target:dependency(1);
+    local filename = target:filename();
+    printf( leaf(filename) );
+    system( lalrc, ('lalrc -a "%s" "%s"'):format(filename, target:dependency(2)) );
+end
+
+return LalrcActions;
@@ -9,6 +9,7 @@ end
 
 function lalr.initialize( toolset )
 	toolset.Lalrc = require( 'forge.lalr.Lalrc' );
+	toolset.LalrcActions = require( 'forge.lalr.LalrcActions' );
 	return true;
 end
 
@@ -0,0 +1,86 @@
+#ifndef LALR_BATCHPARSER_HPP_INCLUDED
+#define LALR_BATCHPARSER_HPP_INCLUDED
+
+#include "Parser.hpp"
+#include <vector>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <functional>
+#include <utility>
+
+namespace lalr
+{
+
+class ErrorPolicy;
+class ParserStateMachine;
+
+/**
+// Parse many independent documents concurrently.
+//
+// Worker threads are started once by the constructor and parse each batch
+// alongside the thread that calls BatchParser::parse().  Each worker 
+// reuses one Parser for every document that it parses.
+// Documents are divided evenly between workers up front and workers that 
+// run out of documents steal from the back of other workers' queues so 
+// that uneven documents don't leave workers idle.
+*/
+template <class Iterator, class UserData = std::shared_ptr<ParserUserData<typename std::iterator_traits<Iterator>::value_type> >, class Char = typename std::iterator_traits<Iterator>::value_type, class Traits = typename std::char_traits<Char>, class Allocator = typename std::allocator<Char> >
+class BatchParser
+{
+    public:
+        typedef lalr::Parser<Iterator, UserData, Char, Traits, Allocator> Parser;
+        typedef std::function<void (Parser* parser)> BindFunction;
+        typedef std::pair<Iterator, Iterator> Document;
+
+    private:
+        struct Result
+        {
+            UserData user_data_;
+            bool accepted_;
+            bool full_;
+            Result();
+        };
+
+        struct Worker
+        {
+            std::unique_ptr<Parser> parser_;
+            std::deque<size_t> documents_;
+            std::mutex mutex_;
+            Worker( Parser* parser );
+        };
+
+        std::vector<std::unique_ptr<Worker>> workers_; ///< The workers that documents are parsed by.
+        std::vector<Result> results_; ///< The results of parsing each document from the most recent batch in input order.
+        std::vector<std::thread> threads_; ///< The threads that parse for every worker but the first.
+        std::mutex mutex_; ///< Guards batch_, batches_, running_, and stopping_.
+        std::condition_variable batch_started_; ///< Notified when a batch starts or the threads should exit.
+        std::condition_variable batch_finished_; ///< Notified when the last thread finishes its part of a batch.
+        const std::vector<Document>* batch_; ///< The documents in the batch being parsed or null between batches.
+        unsigned int batches_; ///< The number of batches started so that threads can tell when a new batch starts.
+        size_t running_; ///< The number of threads still parsing the current batch.
+        bool stopping_; ///< True when the threads should exit otherwise false.
+
+    public:
+        BatchParser( const ParserStateMachine* state_machine, BindFunction bind, int threads = 0, ErrorPolicy* error_policy = nullptr );
+        ~BatchParser();
+        int threads() const;
+        void parse( const std::vector<Document>& documents );
+        size_t size() const;
+        bool accepted( size_t index ) const;
+        bool full( size_t index ) const;
+        const UserData& user_data( size_t index ) const;
+
+    private:
+        void run( size_t worker );
+        void work( size_t worker, const std::vector<Document>* documents );
+        bool pop( size_t worker, size_t* document );
+};
+
+}
+
+#include "BatchParser.ipp"
+
+#endif
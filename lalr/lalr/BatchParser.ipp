@@ -0,0 +1,349 @@
+#ifndef LALR_BATCHPARSER_IPP_INCLUDED
+#define LALR_BATCHPARSER_IPP_INCLUDED
+
+#include "BatchParser.hpp"
+#include "Parser.ipp"
+#include "assert.hpp"
+#include <algorithm>
+
+namespace lalr
+{
+
+template <class Iterator, class UserData, class Char, class Traits, class Allocator>
+BatchParser<Iterator, UserData, Char, Traits, Allocator>::Result::Result()
+: user_data_(),
+  accepted_( false ),
+  full_( false )
+{
+}
+
+template <class Iterator, class UserData, class Char, class Traits, class Allocator>
+BatchParser<Iterator, UserData, Char, Traits, Allocator>::Worker::Worker( Parser* parser )
+: parser_( parser ),
+  documents_(),
+  mutex_()
+{
+    LALR_ASSERT( parser_ );
+}
+
+/**
+// Constructor.
+//
+// @param state_machine
+//  The state machine shared by the parsers of every worker (assumed not 
+//  null).
+//
+// @param bind
+//  The function called once for the parser of each worker to bind its 
+//  action handlers (assumed not empty).  Handlers may be called from any 
+//  worker's thread and so must be safe to call concurrently.
+//
+// @param threads
+//  The number of worker threads to parse with or 0 to use one worker per
+//  hardware thread.
+//
+// @param error_policy
+//  The error policy shared by the parsers of every worker or null to 
+//  ignore errors.  It may be called from any worker's thread.
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator>
+BatchParser<Iterator, UserData, Char, Traits, Allocator>::BatchParser( const ParserStateMachine* state_machine, BindFunction bind, int threads, ErrorPolicy* error_policy )
+: workers_(),
+  results_(),
+  threads_(),
+  mutex_(),
+  batch_started_(),
+  batch_finished_(),
+  batch_( nullptr ),
+  batches_( 0 ),
+  running_( 0 ),
+  stopping_( false )
+{
+    LALR_ASSERT( state_machine );
+    LALR_ASSERT( bind );
+    LALR_ASSERT( threads >= 0 );
+
+    if ( threads == 0 )
+    {
+        threads = std::max( int(std::thread::hardware_concurrency()), 1 );
+    }
+
+    workers_.reserve( threads );
+    for ( int i = 0; i < threads; ++i )
+    {
+        Parser* parser = new Parser( state_machine, error_policy );
+        workers_.push_back( std::unique_ptr<Worker>(new Worker(parser)) );
+        bind( parser );
+    }
+
+    threads_.reserve( threads - 1 );
+    for ( int i = 1; i < threads; ++i )
+    {
+        threads_.push_back( std::thread(&BatchParser::run, this, size_t(i)) );
+    }
+}
+
+/**
+// Destructor.
+//
+// Stops and joins the worker threads.
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator>
+BatchParser<Iterator, UserData, Char, Traits, Allocator>::~BatchParser()
+{
+    {
+        std::lock_guard<std::mutex> lock( mutex_ );
+        stopping_ = true;
+    }
+    batch_started_.notify_all();
+    for ( auto i = threads_.begin(); i != threads_.end(); ++i )
+    {
+        i->join();
+    }
+}
+
+/**
+// Get the number of worker threads that this BatchParser parses with.
+//
+// @return
+//  The number of worker threads.
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator>
+int BatchParser<Iterator, UserData, Char, Traits, Allocator>::threads() const
+{
+    return int(workers_.size());
+}
+
+/**
+// Parse each of \e documents.
+//
+// The calling thread parses as the first worker alongside the worker 
+// threads and returns once every document has been parsed.  The results of the previous batch are 
+// discarded.
+//
+// @param documents
+//  The [begin, end) range of each document to parse.
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator>
+void BatchParser<Iterator, UserData, Char, Traits, Allocator>::parse( const std::vector<Document>& documents )
+{
+    results_.clear();
+    results_.resize( documents.size() );
+
+    size_t workers = workers_.size();
+    for ( size_t i = 0; i < workers; ++i )
+    {
+        Worker* worker = workers_[i].get();
+        worker->documents_.clear();
+        size_t begin = documents.size() * i / workers;
+        size_t end = documents.size() * (i + 1) / workers;
+        for ( size_t document = begin; document < end; ++document )
+        {
+            worker->documents_.push_back( document );
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock( mutex_ );
+        batch_ = &documents;
+        ++batches_;
+        running_ = threads_.size();
+    }
+    batch_started_.notify_all();
+
+    work( 0, &documents );
+
+    std::unique_lock<std::mutex> lock( mutex_ );
+    while ( running_ > 0 )
+    {
+        batch_finished_.wait( lock );
+    }
+    batch_ = nullptr;
+}
+
+/**
+// Get the number of documents parsed in the most recent batch.
+//
+// @return
+//  The number of documents.
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator>
+size_t BatchParser<Iterator, UserData, Char, Traits, Allocator>::size() const
+{
+    return results_.size();
+}
+
+/**
+// Did the parse of a document in the most recent batch accept its input?
+//
+// @param index
+//  The index of the document in the most recent batch.
+//
+// @return
+//  True if the document was parsed successfully otherwise false.
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator>
+bool BatchParser<Iterator, UserData, Char, Traits, Allocator>::accepted( size_t index ) const
+{
+    LALR_ASSERT( index < results_.size() );
+    return results_[index].accepted_;
+}
+
+/**
+// Did the parse of a document in the most recent batch consume all of its
+// input?
+//
+// @param index
+//  The index of the document in the most recent batch.
+//
+// @return
+//  True if all of the document was consumed otherwise false.
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator>
+bool BatchParser<Iterator, UserData, Char, Traits, Allocator>::full( size_t index ) const
+{
+    LALR_ASSERT( index < results_.size() );
+    return results_[index].full_;
+}
+
+/**
+// Get the user data that resulted from parsing a document in the most 
+// recent batch.
+//
+// @param index
+//  The index of the document in the most recent batch.
+//
+// @return
+//  The user data or default constructed user data if the document wasn't
+//  accepted.
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator>
+const UserData& BatchParser<Iterator, UserData, Char, Traits, Allocator>::user_data( size_t index ) const
+{
+    LALR_ASSERT( index < results_.size() );
+    return results_[index].user_data_;
+}
+
+/**
+// Parse each batch on behalf of a worker until this BatchParser is 
+// destroyed.
+//
+// @param worker
+//  The index of the worker to parse for (assumed > 0 as the first worker
+//  parses on the thread that calls BatchParser::parse()).
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator>
+void BatchParser<Iterator, UserData, Char, Traits, Allocator>::run( size_t worker )
+{
+    LALR_ASSERT( worker > 0 && worker < workers_.size() );
+
+    // No batch has started before the constructor returns so threads that
+    // start late still see the first batch as new.
+    std::unique_lock<std::mutex> lock( mutex_ );
+    unsigned int batches = 0;
+    for ( ;; )
+    {
+        while ( batches_ == batches && !stopping_ )
+        {
+            batch_started_.wait( lock );
+        }
+        if ( stopping_ )
+        {
+            break;
+        }
+
+        batches = batches_;
+        const std::vector<Document>* documents = batch_;
+        lock.unlock();
+        work( worker, documents );
+        lock.lock();
+        if ( --running_ == 0 )
+        {
+            batch_finished_.notify_one();
+        }
+    }
+}
+
+/**
+// Parse documents on behalf of a worker until there are none left.
+//
+// @param worker
+//  The index of the worker to parse for.
+//
+// @param documents
+//  The documents in the batch being parsed (assumed not null).
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator>
+void BatchParser<Iterator, UserData, Char, Traits, Allocator>::work( size_t worker, const std::vector<Document>* documents )
+{
+    LALR_ASSERT( worker < workers_.size() );
+    LALR_ASSERT( documents );
+
+    Parser* parser = workers_[worker]->parser_.get();
+    size_t document = 0;
+    while ( pop(worker, &document) )
+    {
+        const Document& input = (*documents)[document];
+        parser->parse( input.first, input.second );
+        Result& result = results_[document];
+        result.accepted_ = parser->accepted();
+        result.full_ = parser->full();
+        if ( result.accepted_ )
+        {
+            result.user_data_ = parser->user_data();
+        }
+    }
+}
+
+/**
+// Take the next document for a worker to parse.
+//
+// Documents are taken from the front of the worker's own queue and, once
+// that is empty, stolen from the back of the queues of other workers.
+//
+// @param worker
+//  The index of the worker to take a document for.
+//
+// @param document
+//  A variable to receive the index of the document taken (assumed not 
+//  null).
+//
+// @return
+//  True if a document was taken otherwise false if there are no documents
+//  left to parse.
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator>
+bool BatchParser<Iterator, UserData, Char, Traits, Allocator>::pop( size_t worker, size_t* document )
+{
+    LALR_ASSERT( worker < workers_.size() );
+    LALR_ASSERT( document );
+
+    Worker* own = workers_[worker].get();
+    {
+        std::lock_guard<std::mutex> lock( own->mutex_ );
+        if ( !own->documents_.empty() )
+        {
+            *document = own->documents_.front();
+            own->documents_.pop_front();
+            return true;
+        }
+    }
+
+    size_t workers = workers_.size();
+    for ( size_t i = 1; i < workers; ++i )
+    {
+        Worker* victim = workers_[(worker + i) % workers].get();
+        std::lock_guard<std::mutex> lock( victim->mutex_ );
+        if ( !victim->documents_.empty() )
+        {
+            *document = victim->documents_.back();
+            victim->documents_.pop_back();
+            return true;
+        }
+    }
+    return false;
+}
+
+}
+
+#endif
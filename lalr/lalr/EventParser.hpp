@@ -0,0 +1,83 @@
+#ifndef LALR_EVENTPARSER_HPP_INCLUDED
+#define LALR_EVENTPARSER_HPP_INCLUDED
+
+#include "Lexer.hpp"
+#include "AddLexerActionHandler.hpp"
+#include <vector>
+#include <memory>
+#include <string>
+#include <functional>
+
+namespace lalr
+{
+
+class ErrorPolicy;
+class ParserAction;
+class ParserSymbol;
+class ParserState;
+class ParserTransition;
+class ParserStateMachine;
+
+/**
+// A %parser that reports shifts and reductions as events rather than 
+// building user data.
+//
+// An %EventParser keeps only a stack of state indices, one per symbol on
+// the stack, so memory use is proportional to the nesting depth of the 
+// input and nothing is allocated per token.  Shifts and reductions are
+// passed to a handler, in the style of SAX, that builds whatever it needs
+// from them:
+//
+//  - `handler->on_shift( const ParserSymbol* symbol, const Char* lexeme_begin, const Char* lexeme_end )`
+//    is called as each token is shifted with the token's lexeme, which is 
+//    only valid for the duration of the call.  The error symbol is shifted 
+//    with a null lexeme during error recovery.
+//
+//  - `handler->on_reduce( const ParserSymbol* symbol, const ParserAction* action, size_t length )`
+//    is called as each production is reduced with the symbol reduced to, 
+//    the action attached to the production (or null if there is none), and 
+//    the number of symbols reduced.
+//
+// The handler is a template parameter so that calls to it can be inlined.
+*/
+template <class Iterator, class Handler, class Char = typename std::iterator_traits<Iterator>::value_type, class Traits = typename std::char_traits<Char>, class Allocator = typename std::allocator<Char> >
+class EventParser
+{
+    public:
+        typedef std::function<void (Iterator begin, Iterator end, std::basic_string<Char, Traits, Allocator>* lexeme, const void** symbol, Iterator* position, int* lines)> LexerActionFunction;
+
+    private:
+        const ParserStateMachine* state_machine_; ///< The data that defines the state machine used by this parser.
+        ErrorPolicy* error_policy_; ///< The error policy this parser uses to report errors.
+        Handler* handler_; ///< The handler that shift and reduce events are passed to.
+        std::vector<int> states_; ///< The stack of the indices of the states that symbols are shifted and reduced from.
+        Lexer<Iterator, Char, Traits, Allocator> lexer_; ///< The lexical analyzer used during parsing.
+        bool accepted_; ///< True if the parser accepted its input otherwise false.
+        bool full_; ///< True if the parser processed all of its input otherwise false.
+        bool error_recovery_enabled_; ///< True if syntax errors are recovered from by shifting the error symbol otherwise false.
+
+    public:
+        EventParser( const ParserStateMachine* state_machine, Handler* handler, ErrorPolicy* error_policy = nullptr );
+        void parse( Iterator start, Iterator finish );
+        bool accepted() const;
+        bool full() const;
+        const Lexer<Iterator, Char, Traits, Allocator>& lexer() const;
+        AddLexerActionHandler<Iterator, Char, Traits, Allocator> lexer_action_handlers();
+        void set_lexer_action_handler( const char* identifier, LexerActionFunction function );
+        void set_error_recovery_enabled( bool error_recovery_enabled );
+        bool is_error_recovery_enabled() const;
+
+    private:
+        bool parse_token();
+        const ParserState* state() const;
+        const ParserTransition* reduce_until_shift( const ParserSymbol* symbol, bool* accepted, bool* rejected );
+        void reduce_by_default( bool* accepted, bool* rejected );
+        void shift( const ParserTransition* transition, const ParserSymbol* symbol, const Char* lexeme_begin, const Char* lexeme_end );
+        void reduce( const ParserTransition* transition, bool* accepted );
+        void error( bool* accepted, bool* rejected );
+        void fire_error( int line, int column, int error, const char* format, ... ) const;
+};
+
+}
+
+#endif
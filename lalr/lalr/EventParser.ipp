@@ -0,0 +1,437 @@
+#ifndef LALR_EVENTPARSER_IPP_INCLUDED
+#define LALR_EVENTPARSER_IPP_INCLUDED
+
+#include "EventParser.hpp"
+#include "ParserLookup.hpp"
+#include "ParserState.hpp"
+#include "ParserTransition.hpp"
+#include "ParserAction.hpp"
+#include "ParserSymbol.hpp"
+#include "ParserStateMachine.hpp"
+#include "ErrorCode.hpp"
+#include "Lexer.ipp"
+#include "AddLexerActionHandler.ipp"
+#include "ErrorPolicy.hpp"
+#include "assert.hpp"
+#include <stdarg.h>
+
+namespace lalr
+{
+
+/**
+// Constructor.
+//
+// @param state_machine
+//  The state machine and actions that this %EventParser will use (assumed
+//  not null).
+//
+// @param handler
+//  The handler to pass shift and reduce events to (assumed not null).
+//
+// @param error_policy
+//  The error policy to report errors during parsing to or null to 
+//  silently swallow errors.
+*/
+template <class Iterator, class Handler, class Char, class Traits, class Allocator>
+EventParser<Iterator, Handler, Char, Traits, Allocator>::EventParser( const ParserStateMachine* state_machine, Handler* handler, ErrorPolicy* error_policy )
+: state_machine_( state_machine ),
+  error_policy_( error_policy ),
+  handler_( handler ),
+  states_(),
+  lexer_( state_machine_->lexer_state_machine, state_machine_->whitespace_lexer_state_machine, state_machine_->end_symbol, error_policy ),
+  accepted_( false ),
+  full_( false ),
+  error_recovery_enabled_( true )
+{
+    LALR_ASSERT( state_machine_ );
+    LALR_ASSERT( handler_ );
+    lexer_.set_lazy_positions_enabled( true );
+}
+
+/**
+// Parse [\e start, \e finish).
+//
+// After the parse the EventParser::full() and EventParser::accepted() 
+// functions can be used to determine whether or not the parse was 
+// successful and whether or not it consumed all of the available input.
+//
+// @param start
+//  The first character in the sequence to parse.
+//
+// @param finish
+//  One past the last character in the sequence to parse.
+*/
+template <class Iterator, class Handler, class Char, class Traits, class Allocator>
+void EventParser<Iterator, Handler, Char, Traits, Allocator>::parse( Iterator start, Iterator finish )
+{
+    LALR_ASSERT( state_machine_ );
+
+    accepted_ = false;
+    full_ = false;
+    states_.clear();
+    states_.push_back( state_machine_->start_state->index );
+    lexer_.reset( start, finish );
+    lexer_.advance();
+    while ( parse_token() )
+    {
+        lexer_.advance();
+    }
+
+    full_ = lexer_.full();
+}
+
+/**
+// Did the most recent parse accept input successfully?
+//
+// @return
+//  True if the input was parsed successfully otherwise false.
+*/
+template <class Iterator, class Handler, class Char, class Traits, class Allocator>
+bool EventParser<Iterator, Handler, Char, Traits, Allocator>::accepted() const
+{
+    return accepted_;
+}
+
+/**
+// Did the most recent parse consume all of the input?
+//
+// @return
+//  True if all of the input was consumed otherwise false.
+*/
+template <class Iterator, class Handler, class Char, class Traits, class Allocator>
+bool EventParser<Iterator, Handler, Char, Traits, Allocator>::full() const
+{
+    return full_;
+}
+
+/**
+// Get the Lexer that this %EventParser is using.
+//
+// @return
+//  The Lexer.
+*/
+template <class Iterator, class Handler, class Char, class Traits, class Allocator>
+const Lexer<Iterator, Char, Traits, Allocator>& EventParser<Iterator, Handler, Char, Traits, Allocator>::lexer() const
+{
+    return lexer_;
+}
+
+/**
+// Get an AddLexerActionHandler object that can be used to add lexer action
+// handlers to this %EventParser.
+//
+// @return
+//  An AddLexerActionHandler.
+*/
+template <class Iterator, class Handler, class Char, class Traits, class Allocator>
+AddLexerActionHandler<Iterator, Char, Traits, Allocator> EventParser<Iterator, Handler, Char, Traits, Allocator>::lexer_action_handlers()
+{
+    return AddLexerActionHandler<Iterator, Char, Traits, Allocator>( &lexer_ );
+}
+
+/**
+// Set the handler for a lexer action.
+//
+// @param identifier
+//  The identifier of the lexer action to set the handler for (assumed not
+//  null).
+//
+// @param function
+//  The function to call when the lexer action is taken.
+*/
+template <class Iterator, class Handler, class Char, class Traits, class Allocator>
+void EventParser<Iterator, Handler, Char, Traits, Allocator>::set_lexer_action_handler( const char* identifier, LexerActionFunction function )
+{
+    LALR_ASSERT( identifier );
+    lexer_.set_action_handler( identifier, function );
+}
+
+/**
+// Enable or disable recovering from syntax errors.
+//
+// When enabled syntax errors are recovered from using the error symbol as 
+// specified by the grammar.  When disabled the input is rejected at the 
+// first syntax error.
+//
+// @param error_recovery_enabled
+//  True to recover from syntax errors or false to reject the input at the
+//  first syntax error.
+*/
+template <class Iterator, class Handler, class Char, class Traits, class Allocator>
+void EventParser<Iterator, Handler, Char, Traits, Allocator>::set_error_recovery_enabled( bool error_recovery_enabled )
+{
+    error_recovery_enabled_ = error_recovery_enabled;
+}
+
+/**
+// Are syntax errors recovered from?
+//
+// @return
+//  True if syntax errors are recovered from otherwise false.
+*/
+template <class Iterator, class Handler, class Char, class Traits, class Allocator>
+bool EventParser<Iterator, Handler, Char, Traits, Allocator>::is_error_recovery_enabled() const
+{
+    return error_recovery_enabled_;
+}
+
+/**
+// Continue a parse by accepting the token most recently matched by the
+// lexer.
+//
+// @return
+//  True until parsing is complete or an error occurs.
+*/
+template <class Iterator, class Handler, class Char, class Traits, class Allocator>
+bool EventParser<Iterator, Handler, Char, Traits, Allocator>::parse_token()
+{
+    bool accepted = false;
+    bool rejected = false;
+
+    const ParserSymbol* symbol = reinterpret_cast<const ParserSymbol*>( lexer_.symbol() );
+    const ParserTransition* transition = reduce_until_shift( symbol, &accepted, &rejected );
+    if ( transition )
+    {
+        const Char* lexeme_begin = nullptr;
+        const Char* lexeme_end = nullptr;
+        if ( !lexer_.lexeme_range(&lexeme_begin, &lexeme_end) )
+        {
+            const std::basic_string<Char, Traits, Allocator>& lexeme = lexer_.lexeme();
+            lexeme_begin = lexeme.data();
+            lexeme_end = lexeme.data() + lexeme.size();
+        }
+        shift( transition, symbol, lexeme_begin, lexeme_end );
+        reduce_by_default( &accepted, &rejected );
+    }
+    else if ( !accepted && !rejected )
+    {
+        error( &accepted, &rejected );
+    }
+
+    accepted_ = accepted;
+    return !accepted_ && !rejected;
+}
+
+/**
+// Get the state on the top of the stack.
+//
+// @return
+//  The state.
+*/
+template <class Iterator, class Handler, class Char, class Traits, class Allocator>
+const ParserState* EventParser<Iterator, Handler, Char, Traits, Allocator>::state() const
+{
+    LALR_ASSERT( !states_.empty() );
+    return &state_machine_->states[states_.back()];
+}
+
+/**
+// Make any reductions on \e symbol needed before it can be shifted.
+//
+// @param symbol
+//  The symbol that is about to be shifted.
+//
+// @param accepted
+//  A variable to receive whether or not this parser has accepted its input.
+//
+// @param rejected
+//  A variable to receive whether or not this parser has rejected its input.
+//
+// @return
+//  The transition that shifts \e symbol or null if \e symbol can't be 
+//  shifted (because the input has been accepted, rejected, or is in error).
+*/
+template <class Iterator, class Handler, class Char, class Traits, class Allocator>
+const ParserTransition* EventParser<Iterator, Handler, Char, Traits, Allocator>::reduce_until_shift( const ParserSymbol* symbol, bool* accepted, bool* rejected )
+{
+    LALR_ASSERT( accepted );
+    LALR_ASSERT( rejected );
+    const ParserState* top = state();
+    const ParserTransition* transition = top->default_transition ? top->default_transition : find_parser_transition( state_machine_, symbol, top );
+    while ( !*accepted && !*rejected && transition && transition->type == TRANSITION_REDUCE )
+    {
+        reduce( transition, accepted );
+        top = state();
+        transition = top->default_transition ? top->default_transition : find_parser_transition( state_machine_, symbol, top );
+    }
+    return transition && transition->type == TRANSITION_SHIFT ? transition : nullptr;
+}
+
+/**
+// Make default reductions from the state on the top of the stack until a
+// state that must examine the next token is reached.
+//
+// @param accepted
+//  A variable to receive whether or not this parser has accepted its input.
+//
+// @param rejected
+//  A variable to receive whether or not this parser has rejected its input.
+*/
+template <class Iterator, class Handler, class Char, class Traits, class Allocator>
+void EventParser<Iterator, Handler, Char, Traits, Allocator>::reduce_by_default( bool* accepted, bool* rejected )
+{
+    LALR_ASSERT( accepted );
+    LALR_ASSERT( rejected );
+    const ParserTransition* transition = state()->default_transition;
+    while ( !*accepted && !*rejected && transition )
+    {
+        reduce( transition, accepted );
+        transition = state()->default_transition;
+    }
+}
+
+/**
+// Shift a token onto the stack.
+//
+// @param transition
+//  The shift transition that specifies the state that will be transitioned
+//  into after the shift.
+//
+// @param symbol
+//  The symbol of the token that is being shifted.
+//
+// @param lexeme_begin
+//  The first character of the lexeme of the token being shifted.
+//
+// @param lexeme_end
+//  One past the last character of the lexeme of the token being shifted.
+*/
+template <class Iterator, class Handler, class Char, class Traits, class Allocator>
+void EventParser<Iterator, Handler, Char, Traits, Allocator>::shift( const ParserTransition* transition, const ParserSymbol* symbol, const Char* lexeme_begin, const Char* lexeme_end )
+{
+    LALR_ASSERT( transition );
+    LALR_ASSERT( transition->state );
+    handler_->on_shift( symbol, lexeme_begin, lexeme_end );
+    states_.push_back( transition->state->index );
+}
+
+/**
+// Reduce the top of the stack by the production that \e transition 
+// reduces.
+//
+// @param transition
+//  The reducing transition.
+//
+// @param accepted
+//  A variable to receive whether or not this parser has accepted its input.
+*/
+template <class Iterator, class Handler, class Char, class Traits, class Allocator>
+void EventParser<Iterator, Handler, Char, Traits, Allocator>::reduce( const ParserTransition* transition, bool* accepted )
+{
+    LALR_ASSERT( state_machine_ );
+    LALR_ASSERT( transition );
+    LALR_ASSERT( accepted );
+
+    const ParserSymbol* symbol = transition->reduced_symbol;
+    if ( symbol != state_machine_->start_symbol )
+    {
+        size_t length = size_t(transition->reduced_length);
+        LALR_ASSERT( length < states_.size() );
+        states_.resize( states_.size() - length );
+        const ParserState* state = find_parser_goto( state_machine_, symbol, this->state() );
+        LALR_ASSERT( state );
+        const ParserAction* action = transition->action != ParserAction::INVALID_INDEX ? &state_machine_->actions[transition->action] : nullptr;
+        handler_->on_reduce( symbol, action, length );
+        states_.push_back( state->index );
+    }
+    else
+    {
+        LALR_ASSERT( states_.size() == 2 );
+        *accepted = true;
+    }
+}
+
+/**
+// Handle an error.
+//
+// Pops states from the stack until the 'error' token can be shifted and then
+// shifts the error token.  Any transitions that call for a reduce on the 
+// 'error' token are taken.
+//
+// @param accepted
+//  A variable to receive whether or not this parser has accepted its input.
+//
+// @param rejected
+//  A variable to receive whether or not this parser has rejected its input.
+*/
+template <class Iterator, class Handler, class Char, class Traits, class Allocator>
+void EventParser<Iterator, Handler, Char, Traits, Allocator>::error( bool* accepted, bool* rejected )
+{
+    LALR_ASSERT( state_machine_ );
+    LALR_ASSERT( !states_.empty() );
+    LALR_ASSERT( accepted );
+    LALR_ASSERT( rejected );
+
+    if ( !error_recovery_enabled_ )
+    {
+        fire_error( lexer_.line(), lexer_.column(), PARSER_ERROR_SYNTAX, "Syntax error" );
+        *rejected = true;
+        return;
+    }
+
+    bool handled = false;
+    while ( !states_.empty() && !handled && !*accepted && !*rejected )
+    {
+        const ParserTransition* transition = find_parser_transition( state_machine_, state_machine_->error_symbol, state() );
+        if ( transition )
+        {
+            switch ( transition->type )
+            {
+                case TRANSITION_SHIFT:
+                    shift( transition, state_machine_->error_symbol, nullptr, nullptr );
+                    handled = true;
+                    break;
+
+                case TRANSITION_REDUCE:
+                    reduce( transition, accepted );
+                    break;
+                    
+                default:
+                    LALR_ASSERT( false );
+                    fire_error( lexer_.line(), lexer_.column(), PARSER_ERROR_UNEXPECTED, "Unexpected transition type '%d'", transition->type );
+                    *rejected = true;
+                    break;
+            }
+        }
+        else
+        {
+            states_.pop_back();
+        }
+    }
+    
+    if ( states_.empty() )
+    {
+        fire_error( lexer_.line(), lexer_.column(), PARSER_ERROR_SYNTAX, "Syntax error" );
+        *rejected = true;
+    }
+}
+
+/**
+// Fire an %error event.
+//
+// @param line
+//  The line number to associate with the %error (or 0 if there is no line
+//  to associate with the %error).
+//
+// @param column
+//  The column number to associate with the %error (or 0 if there is no 
+//  column to associate with the %error).
+//
+// @param error
+//  The %Error that describes the %error that has occured.
+*/
+template <class Iterator, class Handler, class Char, class Traits, class Allocator>
+void EventParser<Iterator, Handler, Char, Traits, Allocator>::fire_error( int line, int column, int error, const char* format, ... ) const
+{
+    if ( error_policy_ )
+    {
+        va_list args;
+        va_start( args, format );
+        error_policy_->lalr_error( line, column, error, format, args );
+        va_end( args );
+    }
+}
+
+}
+
+#endif
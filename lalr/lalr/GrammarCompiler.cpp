@@ -20,27 +20,140 @@
 #include "ParserTransition.hpp"
 #include "RegexCompiler.hpp"
 #include "ErrorPolicy.hpp"
+#include "ThreadPool.hpp"
 #include "assert.hpp"
+#include <algorithm>
 #include <iterator>
+#include <chrono>
+#include <stdio.h>
 #include <string.h>
 
 using std::set;
 using std::vector;
 using std::copy;
+using std::fill;
+using std::max;
+using std::stable_sort;
 using std::back_inserter;
 using std::unique_ptr;
-using std::shared_ptr;
 using namespace lalr;
 
+namespace
+{
+
+/**
+// Records the errors and debug output from a phase of compilation that 
+// runs concurrently with other phases so that they can be reported once 
+// the phases have finished in the same order that a serial compile would
+// report them.
+*/
+class DeferredErrorPolicy : public ErrorPolicy
+{
+    struct Message
+    {
+        bool error; ///< True if this message is an error otherwise false for debug output.
+        int line; ///< The line that the error occured on.
+        int column; ///< The column that the error occured on.
+        int code; ///< The error code.
+        std::string text; ///< The formatted text of the message.
+    };
+
+    std::vector<Message> messages_; ///< The recorded messages in the order that they were sent.
+
+public:
+    void lalr_error( int line, int column, int error, const char* format, va_list args )
+    {
+        Message message = { true, line, column, error, format_text(format, args) };
+        messages_.push_back( message );
+    }
+
+    void lalr_vprintf( const char* format, va_list args )
+    {
+        Message message = { false, 0, 0, 0, format_text(format, args) };
+        messages_.push_back( message );
+    }
+
+    void report( ErrorPolicy* error_policy ) const
+    {
+        LALR_ASSERT( error_policy );
+        for ( std::vector<Message>::const_iterator i = messages_.begin(); i != messages_.end(); ++i )
+        {
+            if ( i->error )
+            {
+                report_error( error_policy, i->line, i->column, i->code, "%s", i->text.c_str() );
+            }
+            else
+            {
+                report_printf( error_policy, "%s", i->text.c_str() );
+            }
+        }
+    }
+
+private:
+    static std::string format_text( const char* format, va_list args )
+    {
+        va_list size_args;
+        va_copy( size_args, args );
+        int size = vsnprintf( nullptr, 0, format, size_args );
+        va_end( size_args );
+        std::vector<char> text( size_t(max(size, 0)) + 1 );
+        vsnprintf( &text[0], text.size(), format, args );
+        return std::string( &text[0] );
+    }
+
+    static void report_error( ErrorPolicy* error_policy, int line, int column, int error, const char* format, ... )
+    {
+        va_list args;
+        va_start( args, format );
+        error_policy->lalr_error( line, column, error, format, args );
+        va_end( args );
+    }
+
+    static void report_printf( ErrorPolicy* error_policy, const char* format, ... )
+    {
+        va_list args;
+        va_start( args, format );
+        error_policy->lalr_vprintf( format, args );
+        va_end( args );
+    }
+};
+
+/**
+// Get the wall time elapsed since \e begin.
+//
+// @return
+//  The elapsed time in seconds.
+*/
+double seconds_since( std::chrono::steady_clock::time_point begin )
+{
+    return std::chrono::duration<double>( std::chrono::steady_clock::now() - begin ).count();
+}
+
+}
+
 GrammarCompiler::GrammarCompiler()
 : strings_(),
   actions_(),
   symbols_(),
   transitions_(),
   states_(),
+  action_table_(),
+  goto_table_(),
+  default_table_(),
+  base_table_(),
+  next_table_(),
+  check_table_(),
   lexer_(),
   whitespace_lexer_(),
-  parser_state_machine_()
+  parser_state_machine_(),
+  whitespace_folding_enabled_( false ),
+  lookahead_relations_enabled_( true ),
+  parse_time_( 0.0 ),
+  symbols_time_( 0.0 ),
+  parser_time_( 0.0 ),
+  lexer_time_( 0.0 ),
+  whitespace_lexer_time_( 0.0 ),
+  compile_time_( 0.0 )
 {
     lexer_.reset( new RegexCompiler );
     whitespace_lexer_.reset( new RegexCompiler );
@@ -67,23 +180,136 @@ const ParserStateMachine* GrammarCompiler::parser_state_machine() const
     return parser_state_machine_.get();
 }
 
-int GrammarCompiler::compile( const char* begin, const char* end, ErrorPolicy* error_policy )
+void GrammarCompiler::set_whitespace_folding_enabled( bool whitespace_folding_enabled )
+{
+    whitespace_folding_enabled_ = whitespace_folding_enabled;
+}
+
+bool GrammarCompiler::is_whitespace_folding_enabled() const
+{
+    return whitespace_folding_enabled_;
+}
+
+void GrammarCompiler::set_lookahead_relations_enabled( bool lookahead_relations_enabled )
+{
+    lookahead_relations_enabled_ = lookahead_relations_enabled;
+}
+
+bool GrammarCompiler::is_lookahead_relations_enabled() const
+{
+    return lookahead_relations_enabled_;
+}
+
+double GrammarCompiler::parse_time() const
+{
+    return parse_time_;
+}
+
+double GrammarCompiler::symbols_time() const
+{
+    return symbols_time_;
+}
+
+double GrammarCompiler::parser_time() const
+{
+    return parser_time_;
+}
+
+double GrammarCompiler::lexer_time() const
+{
+    return lexer_time_;
+}
+
+double GrammarCompiler::whitespace_lexer_time() const
 {
+    return whitespace_lexer_time_;
+}
+
+double GrammarCompiler::compile_time() const
+{
+    return compile_time_;
+}
+
+int GrammarCompiler::compile( const char* begin, const char* end, ErrorPolicy* error_policy, int threads )
+{
+    using std::chrono::steady_clock;
+    steady_clock::time_point compile_begin = steady_clock::now();
+    parse_time_ = 0.0;
+    symbols_time_ = 0.0;
+    parser_time_ = 0.0;
+    lexer_time_ = 0.0;
+    whitespace_lexer_time_ = 0.0;
+
     Grammar grammar;
 
     GrammarParser parser;
     int errors = parser.parse( begin, end, error_policy, &grammar );
+    parse_time_ = seconds_since( compile_begin );
     if ( errors == 0 )
     {
+        steady_clock::time_point symbols_begin = steady_clock::now();
         GrammarGenerator generator;
-        errors = generator.generate( grammar, error_policy );
+        generator.set_lookahead_relations_enabled( lookahead_relations_enabled_ );
+        generator.set_threads( threads );
+        errors = generator.generate_symbols( grammar, error_policy );
         if ( errors == 0 )
         {
-            populate_parser_state_machine( grammar, generator );
-            populate_lexer_state_machine( generator, error_policy );
-            populate_whitespace_lexer_state_machine( grammar, error_policy );
+            populate_parser_symbols( grammar, generator );
+        }
+        symbols_time_ = seconds_since( symbols_begin );
+
+        if ( errors == 0 )
+        {
+            // The lexers only depend on the symbols so they're generated 
+            // while this thread generates the parser.  Their errors and 
+            // debug output are reported after the parser's, as they were 
+            // when the phases ran one after the other, and not at all if 
+            // generating the parser fails.  With one thread the pool has no
+            // threads of its own and generates the lexers in wait().
+            DeferredErrorPolicy lexer_error_policy;
+            DeferredErrorPolicy whitespace_lexer_error_policy;
+            ThreadPool pool( threads == 1 ? 0 : 2 );
+            pool.push( [&] ()
+                {
+                    steady_clock::time_point lexer_begin = steady_clock::now();
+                    populate_lexer_state_machine( grammar, generator, error_policy ? &lexer_error_policy : nullptr );
+                    lexer_time_ = seconds_since( lexer_begin );
+                }
+            );
+            pool.push( [&] ()
+                {
+                    steady_clock::time_point whitespace_lexer_begin = steady_clock::now();
+                    populate_whitespace_lexer_state_machine( grammar, error_policy ? &whitespace_lexer_error_policy : nullptr );
+                    whitespace_lexer_time_ = seconds_since( whitespace_lexer_begin );
+                }
+            );
+
+            steady_clock::time_point parser_begin = steady_clock::now();
+            errors = generator.generate_parser();
+            if ( errors == 0 )
+            {
+                populate_parser_state_machine( generator );
+                populate_compressed_tables();
+            }
+            parser_time_ = seconds_since( parser_begin );
+            pool.wait();
+
+            if ( errors == 0 )
+            {
+                if ( error_policy )
+                {
+                    lexer_error_policy.report( error_policy );
+                    whitespace_lexer_error_policy.report( error_policy );
+                }
+                parser_state_machine_->lexer_state_machine = lexer_->state_machine();
+                if ( !grammar.whitespace_tokens().empty() && !whitespace_folding_enabled_ )
+                {
+                    parser_state_machine_->whitespace_lexer_state_machine = whitespace_lexer_->state_machine();
+                }
+            }
         }
     }
+    compile_time_ = seconds_since( compile_begin );
     return errors;
 }
 
@@ -136,6 +362,34 @@ void GrammarCompiler::set_states( std::unique_ptr<ParserState[]>& states, int st
     parser_state_machine_->start_state = start_state;
 }
 
+void GrammarCompiler::set_tables( std::unique_ptr<int[]>& action_table, std::unique_ptr<int[]>& goto_table )
+{
+    LALR_ASSERT( action_table );
+    LALR_ASSERT( goto_table );
+    action_table_ = move( action_table );
+    goto_table_ = move( goto_table );
+    parser_state_machine_->action_table = action_table_.get();
+    parser_state_machine_->goto_table = goto_table_.get();
+}
+
+void GrammarCompiler::set_compressed_tables( std::unique_ptr<int[]>& default_table, std::unique_ptr<int[]>& base_table, std::unique_ptr<int[]>& next_table, std::unique_ptr<int[]>& check_table, int compressed_table_size )
+{
+    LALR_ASSERT( default_table );
+    LALR_ASSERT( base_table );
+    LALR_ASSERT( next_table );
+    LALR_ASSERT( check_table );
+    LALR_ASSERT( compressed_table_size >= 0 );
+    default_table_ = move( default_table );
+    base_table_ = move( base_table );
+    next_table_ = move( next_table );
+    check_table_ = move( check_table );
+    parser_state_machine_->compressed_table_size = compressed_table_size;
+    parser_state_machine_->default_table = default_table_.get();
+    parser_state_machine_->base_table = base_table_.get();
+    parser_state_machine_->next_table = next_table_.get();
+    parser_state_machine_->check_table = check_table_.get();
+}
+
 void GrammarCompiler::set_lexer_allocations( std::unique_ptr<RegexCompiler>& lexer_allocations )
 {
     LALR_ASSERT( lexer_allocations.get() );
@@ -155,7 +409,7 @@ void GrammarCompiler::set_whitespace_lexer_allocations( std::unique_ptr<RegexCom
     }
 }
 
-void GrammarCompiler::populate_parser_state_machine( const Grammar& grammar, const GrammarGenerator& generator )
+void GrammarCompiler::populate_parser_symbols( const Grammar& grammar, const GrammarGenerator& generator )
 {
     const vector<unique_ptr<GrammarAction>>& grammar_actions = generator.actions();
     int actions_size = int(grammar_actions.size());
@@ -185,7 +439,18 @@ void GrammarCompiler::populate_parser_state_machine( const Grammar& grammar, con
         symbol->type = source_symbol->symbol_type();
     }
 
-    const set<shared_ptr<GrammarState>, GrammarStateLess>& grammar_states = generator.states();
+    parser_state_machine_->identifier = add_string( grammar.identifier() );
+    set_actions( actions, actions_size );
+    set_symbols( symbols, symbols_size );
+}
+
+void GrammarCompiler::populate_parser_state_machine( const GrammarGenerator& generator )
+{
+    ParserSymbol* symbols = symbols_.get();
+    int symbols_size = parser_state_machine_->symbols_size;
+    LALR_ASSERT( symbols );
+
+    const vector<unique_ptr<GrammarState>>& grammar_states = generator.states();
     int states_size = int(grammar_states.size());
     unique_ptr<ParserState[]> states( new ParserState [states_size] );
 
@@ -198,6 +463,16 @@ void GrammarCompiler::populate_parser_state_machine( const Grammar& grammar, con
     }
     unique_ptr<ParserTransition[]> transitions( new ParserTransition [transitions_size] );
 
+    // Build dense action and goto tables addressed by state and symbol index
+    // so that the parser can find transitions with a single lookup.  All 
+    // transitions appear in the action table while the goto table holds the
+    // state transitioned to on each non-terminal.
+    int tables_size = states_size * symbols_size;
+    unique_ptr<int[]> action_table( new int [tables_size] );
+    unique_ptr<int[]> goto_table( new int [tables_size] );
+    fill( action_table.get(), action_table.get() + tables_size, int(ParserTransition::INVALID_INDEX) );
+    fill( goto_table.get(), goto_table.get() + tables_size, int(ParserState::INVALID_INDEX) );
+
     const ParserState* start_state = nullptr;
     int state_index = 0;
     int transition_index = 0;
@@ -232,19 +507,165 @@ void GrammarCompiler::populate_parser_state_machine( const Grammar& grammar, con
             transition->action = source_transition->action();
             transition->type = source_transition->type();
             transition->index = transition_index;
+            int table_index = state_index * symbols_size + source_symbol->index();
+            action_table[table_index] = transition_index;
+            if ( source_symbol->symbol_type() == SYMBOL_NON_TERMINAL && state_transitioned_to )
+            {
+                goto_table[table_index] = state_transitioned_to->index();
+            }
             ++transition_index;
         }
+        state->default_transition = find_default_transition( state, &symbols[0] );
         ++state_index;
     }
 
-    parser_state_machine_->identifier = add_string( grammar.identifier() );
-    set_actions( actions, actions_size );
-    set_symbols( symbols, symbols_size );
     set_transitions( transitions, transitions_size );
     set_states( states, states_size, start_state );
+    set_tables( action_table, goto_table );
 }
 
-void GrammarCompiler::populate_lexer_state_machine( const GrammarGenerator& generator, ErrorPolicy* error_policy )
+void GrammarCompiler::populate_compressed_tables()
+{
+    const ParserStateMachine* state_machine = parser_state_machine_.get();
+    LALR_ASSERT( state_machine );
+    int states_size = state_machine->states_size;
+    int symbols_size = state_machine->symbols_size;
+
+    // Choose the most common reduction in each state as that state's default 
+    // in the same way that yacc does.  Reductions to the start symbol are 
+    // never defaults as they would accept input early and transitions on the
+    // error symbol are always kept so that error recovery is unchanged.
+    unique_ptr<int[]> default_table( new int [states_size] );
+    vector<vector<const ParserTransition*>> rows( states_size );
+    for ( int i = 0; i < states_size; ++i )
+    {
+        const ParserState* state = &state_machine->states[i];
+        const ParserTransition* transitions = state->transitions;
+        const ParserTransition* transitions_end = transitions + state->length;
+        const ParserTransition* default_transition = nullptr;
+        int default_count = 0;
+        for ( const ParserTransition* transition = transitions; transition != transitions_end; ++transition )
+        {
+            if ( transition->type == TRANSITION_REDUCE && transition->symbol != state_machine->error_symbol && transition->reduced_symbol != state_machine->start_symbol )
+            {
+                int count = 0;
+                for ( const ParserTransition* other = transitions; other != transitions_end; ++other )
+                {
+                    count += same_reduction( transition, other, state_machine->error_symbol ) ? 1 : 0;
+                }
+                if ( count > default_count )
+                {
+                    default_transition = transition;
+                    default_count = count;
+                }
+            }
+        }
+
+        default_table[i] = default_transition ? default_transition->index : int(ParserTransition::INVALID_INDEX);
+        for ( const ParserTransition* transition = transitions; transition != transitions_end; ++transition )
+        {
+            if ( !default_transition || !same_reduction(default_transition, transition, state_machine->error_symbol) )
+            {
+                rows[i].push_back( transition );
+            }
+        }
+    }
+
+    // Place the remaining rows, longest first, at the lowest offset where 
+    // their entries don't collide with entries already placed and then pad
+    // the tables so that any state's offset plus any symbol index is valid.
+    vector<int> order( states_size );
+    for ( int i = 0; i < states_size; ++i )
+    {
+        order[i] = i;
+    }
+    stable_sort( order.begin(), order.end(), [&rows]( int lhs, int rhs ) {
+        return rows[lhs].size() > rows[rhs].size();
+    } );
+
+    unique_ptr<int[]> base_table( new int [states_size] );
+    int compressed_table_size = symbols_size;
+    vector<int> next( compressed_table_size, int(ParserTransition::INVALID_INDEX) );
+    vector<int> check( compressed_table_size, int(ParserState::INVALID_INDEX) );
+    for ( int i = 0; i < states_size; ++i )
+    {
+        int state_index = order[i];
+        const vector<const ParserTransition*>& row = rows[state_index];
+        int base = 0;
+        while ( collides(row, base, check) )
+        {
+            ++base;
+        }
+
+        base_table[state_index] = base;
+        compressed_table_size = max( compressed_table_size, base + symbols_size );
+        next.resize( compressed_table_size, int(ParserTransition::INVALID_INDEX) );
+        check.resize( compressed_table_size, int(ParserState::INVALID_INDEX) );
+        for ( size_t j = 0; j < row.size(); ++j )
+        {
+            int index = base + row[j]->symbol->index;
+            next[index] = row[j]->index;
+            check[index] = state_index;
+        }
+    }
+
+    unique_ptr<int[]> next_table( new int [compressed_table_size] );
+    unique_ptr<int[]> check_table( new int [compressed_table_size] );
+    copy( next.begin(), next.end(), next_table.get() );
+    copy( check.begin(), check.end(), check_table.get() );
+    set_compressed_tables( default_table, base_table, next_table, check_table, compressed_table_size );
+}
+
+const ParserTransition* GrammarCompiler::find_default_transition( const ParserState* state, const ParserSymbol* start_symbol )
+{
+    // A state that reduces by the same production on every lookahead, and 
+    // has no shifts, can reduce without looking at the lookahead at all.
+    // Reductions to the start symbol are excluded as they accept the input
+    // and so must wait to see the end symbol.
+    LALR_ASSERT( state );
+    const ParserTransition* transitions = state->transitions;
+    const ParserTransition* transitions_end = transitions + state->length;
+    if ( transitions == transitions_end || transitions->type != TRANSITION_REDUCE || transitions->reduced_symbol == start_symbol )
+    {
+        return nullptr;
+    }
+    for ( const ParserTransition* transition = transitions; transition != transitions_end; ++transition )
+    {
+        if ( !same_reduction(transitions, transition, nullptr) )
+        {
+            return nullptr;
+        }
+    }
+    return transitions;
+}
+
+bool GrammarCompiler::same_reduction( const ParserTransition* transition, const ParserTransition* other_transition, const ParserSymbol* error_symbol )
+{
+    LALR_ASSERT( transition );
+    LALR_ASSERT( other_transition );
+    return 
+        other_transition->type == TRANSITION_REDUCE &&
+        other_transition->symbol != error_symbol &&
+        other_transition->reduced_symbol == transition->reduced_symbol &&
+        other_transition->reduced_length == transition->reduced_length &&
+        other_transition->action == transition->action
+    ;
+}
+
+bool GrammarCompiler::collides( const std::vector<const ParserTransition*>& row, int base, const std::vector<int>& check )
+{
+    for ( size_t i = 0; i < row.size(); ++i )
+    {
+        size_t index = size_t(base + row[i]->symbol->index);
+        if ( index < check.size() && check[index] != ParserState::INVALID_INDEX )
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void GrammarCompiler::populate_lexer_state_machine( const Grammar& grammar, const GrammarGenerator& generator, ErrorPolicy* error_policy )
 {
     // Generate tokens for generating the lexical analyzer from each of 
     // the terminal symbols in the grammar.
@@ -265,17 +686,31 @@ void GrammarCompiler::populate_lexer_state_machine( const GrammarGenerator& gene
         }
     }
 
-    lexer_->compile( tokens, error_policy );
-    parser_state_machine_->lexer_state_machine = lexer_->state_machine();
+    // When whitespace folding is enabled the whitespace tokens are matched 
+    // by the same state machine as the other tokens and return a skip 
+    // symbol that the lexer loops over rather than returning to the parser.
+    // The address of the parser state machine is used as the skip symbol 
+    // simply because it can't be confused with any ParserSymbol.
+    const void* skip_symbol = nullptr;
+    if ( whitespace_folding_enabled_ && !grammar.whitespace_tokens().empty() )
+    {
+        skip_symbol = parser_state_machine_.get();
+        const vector<RegexToken>& whitespace_tokens = grammar.whitespace_tokens();
+        for ( auto i = whitespace_tokens.begin(); i != whitespace_tokens.end(); ++i )
+        {
+            tokens.push_back( RegexToken(i->type(), i->line(), i->column(), skip_symbol, i->lexeme()) );
+        }
+    }
+
+    lexer_->compile( tokens, error_policy, skip_symbol );
 }
 
 void GrammarCompiler::populate_whitespace_lexer_state_machine( const Grammar& grammar, ErrorPolicy* error_policy )
 {
     unique_ptr<RegexCompiler> whitespace_lexer_allocations;
     const vector<RegexToken>& whitespace_tokens = grammar.whitespace_tokens();
-    if ( !whitespace_tokens.empty() )
+    if ( !whitespace_tokens.empty() && !whitespace_folding_enabled_ )
     {
         whitespace_lexer_->compile( whitespace_tokens, error_policy );
-        parser_state_machine_->whitespace_lexer_state_machine = whitespace_lexer_->state_machine();
     }
 }
@@ -3,6 +3,7 @@
 
 #include <deque>
 #include <string>
+#include <vector>
 #include <memory>
 
 namespace lalr
@@ -25,9 +26,23 @@ class GrammarCompiler
     std::unique_ptr<ParserSymbol[]> symbols_; ///< The symbols in the grammar for this ParserStateMachine.
     std::unique_ptr<ParserTransition[]> transitions_; ///< The transitions in the state machine for this ParserStateMachine.
     std::unique_ptr<ParserState[]> states_; ///< The states in the state machine for this ParserStateMachine.
+    std::unique_ptr<int[]> action_table_; ///< The transition indices addressed by state and symbol for this ParserStateMachine.
+    std::unique_ptr<int[]> goto_table_; ///< The goto state indices addressed by state and symbol for this ParserStateMachine.
+    std::unique_ptr<int[]> default_table_; ///< The default reduce transition indices addressed by state for this ParserStateMachine.
+    std::unique_ptr<int[]> base_table_; ///< The offsets of each state's row in the compressed tables for this ParserStateMachine.
+    std::unique_ptr<int[]> next_table_; ///< The compressed transition indices for this ParserStateMachine.
+    std::unique_ptr<int[]> check_table_; ///< The owning state of each compressed transition index for this ParserStateMachine.
     std::unique_ptr<RegexCompiler> lexer_; ///< Allocated lexer state machine.
     std::unique_ptr<RegexCompiler> whitespace_lexer_; ///< Allocated whitespace lexer state machine.
     std::unique_ptr<ParserStateMachine> parser_state_machine_; ///< Allocated parser state machine.
+    bool whitespace_folding_enabled_; ///< True if whitespace is skipped by the lexer state machine rather than a separate whitespace lexer state machine.
+    bool lookahead_relations_enabled_; ///< True if lookaheads are calculated from the DeRemer-Pennello relations otherwise false to propagate them between items.
+    double parse_time_; ///< The wall time, in seconds, taken to parse the grammar in the last compile.
+    double symbols_time_; ///< The wall time, in seconds, taken to calculate the symbols in the last compile.
+    double parser_time_; ///< The wall time, in seconds, taken to generate the parser state machine in the last compile.
+    double lexer_time_; ///< The wall time, in seconds, taken to generate the lexer state machine in the last compile.
+    double whitespace_lexer_time_; ///< The wall time, in seconds, taken to generate the whitespace lexer state machine in the last compile.
+    double compile_time_; ///< The wall time, in seconds, taken by the last compile.
 
 public:
     GrammarCompiler();
@@ -35,7 +50,17 @@ public:
     const RegexCompiler* lexer() const;
     const RegexCompiler* whitespace_lexer() const;
     const ParserStateMachine* parser_state_machine() const;
-    int compile( const char* begin, const char* end, ErrorPolicy* error_policy = nullptr );
+    void set_whitespace_folding_enabled( bool whitespace_folding_enabled );
+    bool is_whitespace_folding_enabled() const;
+    void set_lookahead_relations_enabled( bool lookahead_relations_enabled );
+    bool is_lookahead_relations_enabled() const;
+    double parse_time() const;
+    double symbols_time() const;
+    double parser_time() const;
+    double lexer_time() const;
+    double whitespace_lexer_time() const;
+    double compile_time() const;
+    int compile( const char* begin, const char* end, ErrorPolicy* error_policy = nullptr, int threads = 1 );
 
 private:
     const char* add_string( const std::string& string );
@@ -43,10 +68,17 @@ private:
     void set_symbols( std::unique_ptr<ParserSymbol[]>& symbols, int symbols_size );
     void set_transitions( std::unique_ptr<ParserTransition[]>& transitions, int transitions_size );
     void set_states( std::unique_ptr<ParserState[]>& states, int states_size, const ParserState* start_state );
+    void set_tables( std::unique_ptr<int[]>& action_table, std::unique_ptr<int[]>& goto_table );
+    void set_compressed_tables( std::unique_ptr<int[]>& default_table, std::unique_ptr<int[]>& base_table, std::unique_ptr<int[]>& next_table, std::unique_ptr<int[]>& check_table, int compressed_table_size );
     void set_lexer_allocations( std::unique_ptr<RegexCompiler>& lexer_allocations );
     void set_whitespace_lexer_allocations( std::unique_ptr<RegexCompiler>& whitespace_lexer_allocations );
-    void populate_parser_state_machine( const Grammar& grammar, const GrammarGenerator& generator );
-    void populate_lexer_state_machine( const GrammarGenerator& generator, ErrorPolicy* error_policy );
+    void populate_parser_symbols( const Grammar& grammar, const GrammarGenerator& generator );
+    void populate_parser_state_machine( const GrammarGenerator& generator );
+    void populate_compressed_tables();
+    static const ParserTransition* find_default_transition( const ParserState* state, const ParserSymbol* start_symbol );
+    static bool same_reduction( const ParserTransition* transition, const ParserTransition* other_transition, const ParserSymbol* error_symbol );
+    static bool collides( const std::vector<const ParserTransition*>& row, int base, const std::vector<int>& check );
+    void populate_lexer_state_machine( const Grammar& grammar, const GrammarGenerator& generator, ErrorPolicy* error_policy );
     void populate_whitespace_lexer_state_machine( const Grammar& grammar, ErrorPolicy* error_policy );
 };
 
@@ -7,6 +7,7 @@
 #include "GrammarProduction.hpp"
 #include "GrammarState.hpp"
 #include "GrammarItem.hpp"
+#include "GrammarKernelTable.hpp"
 #include "Grammar.hpp"
 #include "GrammarSymbol.hpp"   
 #include "GrammarAction.hpp"
@@ -20,12 +21,15 @@
 #include "RegexCompiler.hpp"
 #include "ErrorPolicy.hpp"
 #include "ErrorCode.hpp"
+#include "ThreadPool.hpp"
 #include "assert.hpp"
+#include <algorithm>
+#include <limits>
+#include <atomic>
 
 using std::set;
 using std::vector;
 using std::unique_ptr;
-using std::shared_ptr;
 using namespace lalr;
 
 /**
@@ -49,7 +53,9 @@ GrammarGenerator::GrammarGenerator()
   end_symbol_( nullptr ),
   error_symbol_( nullptr ),
   start_state_( nullptr ),
-  errors_( 0 )
+  errors_( 0 ),
+  lookahead_relations_enabled_( true ),
+  threads_( 1 )
 {
 }
 
@@ -67,7 +73,7 @@ const std::vector<std::unique_ptr<GrammarSymbol>>& GrammarGenerator::symbols() c
     return symbols_;
 }
 
-const std::set<std::shared_ptr<GrammarState>, GrammarStateLess>& GrammarGenerator::states() const
+const std::vector<std::unique_ptr<GrammarState>>& GrammarGenerator::states() const
 {
     return states_;
 }
@@ -77,7 +83,81 @@ const GrammarState* GrammarGenerator::start_state() const
     return start_state_;
 }
 
-int GrammarGenerator::generate( Grammar& grammar, ErrorPolicy* error_policy )
+/**
+// Enable or disable calculating lookaheads from the DeRemer-Pennello 
+// relations.
+//
+// Both methods generate the same LALR(1) lookaheads; propagation is kept 
+// to cross-check the relations against.
+//
+// @param lookahead_relations_enabled
+//  True to calculate lookaheads from the DeRemer-Pennello relations or 
+//  false to propagate lookaheads between items until nothing changes.
+*/
+void GrammarGenerator::set_lookahead_relations_enabled( bool lookahead_relations_enabled )
+{
+    lookahead_relations_enabled_ = lookahead_relations_enabled;
+}
+
+/**
+// Are lookaheads calculated from the DeRemer-Pennello relations?
+//
+// @return
+//  True if lookaheads are calculated from the DeRemer-Pennello relations
+//  or false if they're propagated between items until nothing changes.
+*/
+bool GrammarGenerator::is_lookahead_relations_enabled() const
+{
+    return lookahead_relations_enabled_;
+}
+
+/**
+// Set the number of threads used to generate states.
+//
+// The states generated are the same for any number of threads.
+//
+// @param threads
+//  The number of threads to use or 0 to use as many threads as the 
+//  hardware can run concurrently (assumed >= 0).
+*/
+void GrammarGenerator::set_threads( int threads )
+{
+    LALR_ASSERT( threads >= 0 );
+    threads_ = threads;
+}
+
+/**
+// Get the number of threads used to generate states.
+//
+// @return
+//  The number of threads or 0 if as many threads as the hardware can run
+//  concurrently are used.
+*/
+int GrammarGenerator::threads() const
+{
+    return threads_;
+}
+
+/**
+// Take the actions, productions, and symbols from \e grammar and 
+// calculate everything about the symbols that generating the parser 
+// depends on.
+//
+// The symbols and their indices are final once this returns without 
+// errors so the lexers can be generated from them while the parser is
+// generated by generate_parser().
+//
+// @param grammar
+//  The grammar to generate a parser for.
+//
+// @param error_policy
+//  The error policy to report errors during generation to or null to 
+//  silently swallow errors.
+//
+// @return
+//  The number of errors that occured.
+*/
+int GrammarGenerator::generate_symbols( Grammar& grammar, ErrorPolicy* error_policy )
 {
     error_policy_ = error_policy;
     identifier_ = grammar.identifier();
@@ -104,7 +184,6 @@ int GrammarGenerator::generate( Grammar& grammar, ErrorPolicy* error_policy )
         calculate_first();
         calculate_follow();
         calculate_precedence_of_productions();
-        generate_states( start_symbol_, end_symbol_, symbols_ );
     }
 
     int errors = errors_;
@@ -112,6 +191,23 @@ int GrammarGenerator::generate( Grammar& grammar, ErrorPolicy* error_policy )
     return errors;
 }
 
+/**
+// Generate the states and transitions of the parser from the symbols 
+// calculated by a successful call to generate_symbols().
+//
+// @return
+//  The number of errors that occured.
+*/
+int GrammarGenerator::generate_parser()
+{
+    LALR_ASSERT( start_symbol_ );
+    LALR_ASSERT( end_symbol_ );
+    generate_states( start_symbol_, end_symbol_ );
+    int errors = errors_;
+    errors_ = 0;
+    return errors;
+}
+
 /**
 // Record and fire and error at the event sink.
 //
@@ -172,9 +268,9 @@ void GrammarGenerator::fire_printf( const char* format, ... ) const
 // @return
 //  The generated lookahead symbols.
 */
-std::set<const GrammarSymbol*, GrammarSymbolLess> GrammarGenerator::lookahead( const GrammarItem& item ) const
+GrammarSymbolSet GrammarGenerator::lookahead( const GrammarItem& item ) const
 {
-    set<const GrammarSymbol*, GrammarSymbolLess> lookahead_symbols;
+    GrammarSymbolSet lookahead_symbols( int(symbols_.size()) );
 
     const GrammarProduction* production = item.production();
     LALR_ASSERT( production );
@@ -190,7 +286,7 @@ std::set<const GrammarSymbol*, GrammarSymbolLess> GrammarGenerator::lookahead( c
     {
         const GrammarSymbol* symbol = *i;
         LALR_ASSERT( symbol );
-        lookahead_symbols.insert( symbol->first().begin(), symbol->first().end() );
+        lookahead_symbols.insert( symbol->first() );
         ++i;
     }
     
@@ -198,77 +294,119 @@ std::set<const GrammarSymbol*, GrammarSymbolLess> GrammarGenerator::lookahead( c
     {
         const GrammarSymbol* symbol = *i;
         LALR_ASSERT( symbol );
-        lookahead_symbols.insert( symbol->first().begin(), symbol->first().end() );
+        lookahead_symbols.insert( symbol->first() );
     }
     else
     {
-        lookahead_symbols.insert( item.lookahead_symbols().begin(), item.lookahead_symbols().end() );
+        lookahead_symbols.insert( item.lookahead_symbols() );
     }
 
     return lookahead_symbols;    
 }
 
 /**
-// Generate the closure of the items contained in \e state.
+// Derive the closure of the kernel items of \e state.
 //
 // @param state
-//  The GrammarState that contains the items to generate the closure of.
+//  The GrammarState that contains the kernel items to derive the closure of.
+//
+// @param items
+//  Filled with the kernel items of \e state followed by an item with the
+//  dot at the beginning for each production of each non-terminal that is 
+//  after the dot in another item (assumed not null).
 */
-void GrammarGenerator::closure( const std::shared_ptr<GrammarState>& state )
+void GrammarGenerator::closure( const GrammarState* state, std::vector<std::pair<GrammarProduction*, int>>* items ) const
 {
     LALR_ASSERT( state );
+    LALR_ASSERT( items );
 
-    int added = 1;
-    while ( added > 0 )
+    items->clear();
+    const set<GrammarItem>& kernel_items = state->items();
+    for ( set<GrammarItem>::const_iterator item = kernel_items.begin(); item != kernel_items.end(); ++item )
     {
-        added = 0;
-        const set<GrammarItem>& items = state->items();
-        for ( set<GrammarItem>::const_iterator item = items.begin(); item != items.end(); ++item )
-        {          
-            const GrammarSymbol* symbol = item->production()->symbol_by_position( item->position() );
-            if ( symbol )
+        items->push_back( std::make_pair(item->production(), item->position()) );
+    }
+
+    vector<char> closed( symbols_.size(), 0 );
+    for ( size_t i = 0; i < items->size(); ++i )
+    {
+        const GrammarSymbol* symbol = (*items)[i].first->symbol_by_position( (*items)[i].second );
+        if ( symbol && !closed[symbol->index()] )
+        {
+            closed[symbol->index()] = 1;
+            const vector<GrammarProduction*>& productions = symbol->productions();
+            for ( vector<GrammarProduction*>::const_iterator j = productions.begin(); j != productions.end(); ++j )
             {
-                const vector<GrammarProduction*>& productions = symbol->productions();
-                for ( vector<GrammarProduction*>::const_iterator j = productions.begin(); j != productions.end(); ++j )
-                {
-                    GrammarProduction* production = *j;
-                    LALR_ASSERT( production );
-                    added += state->add_item( production, 0 );
-                }
+                GrammarProduction* production = *j;
+                LALR_ASSERT( production );
+                items->push_back( std::make_pair(production, 0) );
             }
         }
     }
 }
 
 /**
-// Generate the state that results from accepting \e symbol from \e state.
+// Generate the kernels of the states that result from accepting each 
+// symbol that is after the dot in one or more items in the closure of 
+// \e state.
+//
+// The items in the closure of \e state are bucketed by the symbol after 
+// their dot in one pass so that kernels are only generated for symbols that
+// \e state actually has transitions on.
 //
 // @param state
 //  The state to generate from.
 //
-// @param symbol
-//  The symbol to accept to generate the goto state.
-//
-// @return
-//  The goto state generated when accepting \e symbol from \e state.
+// @param goto_kernels
+//  Filled with the symbols that \e state has transitions on paired with
+//  the kernel of the state transitioned to on each symbol in order of 
+//  symbol index (assumed not null).
 */
-std::shared_ptr<GrammarState> GrammarGenerator::goto_( const std::shared_ptr<GrammarState>& state, const GrammarSymbol& symbol )
+void GrammarGenerator::goto_kernels( const GrammarState* state, std::vector<std::pair<const GrammarSymbol*, GrammarKernel>>* goto_kernels ) const
 {
     LALR_ASSERT( state );
+    LALR_ASSERT( goto_kernels );
 
-    std::shared_ptr<GrammarState> goto_state( new GrammarState() );
+    vector<std::pair<GrammarProduction*, int>> items;
+    closure( state, &items );
+    items.erase( std::remove_if(items.begin(), items.end(), [this] ( const std::pair<GrammarProduction*, int>& item )
+        {
+            const GrammarSymbol* symbol = item.first->symbol_by_position( item.second );
+            return !symbol || symbol == end_symbol_;
+        }
+    ), items.end() );
 
-    const set<GrammarItem>& items = state->items();
-    for ( set<GrammarItem>::const_iterator item = items.begin(); item != items.end(); ++item )
+    std::sort( items.begin(), items.end(), [] ( const std::pair<GrammarProduction*, int>& lhs, const std::pair<GrammarProduction*, int>& rhs )
+        {
+            int lhs_symbol = lhs.first->symbol_by_position( lhs.second )->index();
+            int rhs_symbol = rhs.first->symbol_by_position( rhs.second )->index();
+            return 
+                lhs_symbol < rhs_symbol || 
+                (lhs_symbol == rhs_symbol && (lhs.first->index() < rhs.first->index() || (lhs.first == rhs.first && lhs.second < rhs.second)))
+            ;
+        }
+    );
+
+    size_t size = 0;
+    vector<std::pair<GrammarProduction*, int>>::const_iterator item = items.begin();
+    while ( item != items.end() )
     {
-        if ( item->next_node(symbol) )
+        const GrammarSymbol* symbol = item->first->symbol_by_position( item->second );
+        if ( size == goto_kernels->size() )
+        {
+            goto_kernels->push_back( std::make_pair(symbol, GrammarKernel()) );
+        }
+        std::pair<const GrammarSymbol*, GrammarKernel>& goto_kernel = (*goto_kernels)[size];
+        goto_kernel.first = symbol;
+        goto_kernel.second.clear();
+        while ( item != items.end() && item->first->symbol_by_position(item->second) == symbol )
         {
-            goto_state->add_item( item->production(), item->position() + 1 );
+            goto_kernel.second.add_item( item->first, item->second + 1 );
+            ++item;
         }
+        ++size;
     }
-
-    closure( goto_state );
-    return goto_state;
+    goto_kernels->resize( size );
 }
 
 /**
@@ -295,7 +433,7 @@ int GrammarGenerator::lookahead_closure( GrammarState* state ) const
         const GrammarSymbol* symbol = item->production()->symbol_by_position( item->position() );
         if ( symbol )
         {
-            set<const GrammarSymbol*, GrammarSymbolLess> lookahead_symbols = lookahead( *item );
+            GrammarSymbolSet lookahead_symbols = lookahead( *item );
             const vector<GrammarProduction*>& productions = symbol->productions();
             for ( vector<GrammarProduction*>::const_iterator j = productions.begin(); j != productions.end(); ++j )
             {
@@ -615,19 +753,16 @@ void GrammarGenerator::calculate_follow()
 }
 
 /**
-// Generate the states for a grammar with \e symbols starting with 
-// \e start_symbol and ending when \e end_symbol is accepted.
+// Generate the states for a grammar starting with \e start_symbol and 
+// ending when \e end_symbol is accepted.
 //
 // @param start_symbol
 //  The start symbol for the grammar.
 //
 // @param end_symbol
 //  The end symbol for the grammar.
-//
-// @param symbols
-//  The symbols in the grammar.
 */
-void GrammarGenerator::generate_states( const GrammarSymbol* start_symbol, const GrammarSymbol* end_symbol, const std::vector<std::unique_ptr<GrammarSymbol>>& symbols )
+void GrammarGenerator::generate_states( const GrammarSymbol* start_symbol, const GrammarSymbol* end_symbol )
 {
     LALR_ASSERT( start_symbol );
     LALR_ASSERT( end_symbol );
@@ -635,61 +770,109 @@ void GrammarGenerator::generate_states( const GrammarSymbol* start_symbol, const
 
     if ( !start_symbol->productions().empty() )
     {
-        std::shared_ptr<GrammarState> start_state( new GrammarState() );
-        start_state->add_item( start_symbol->productions().front(), 0 );
-        closure( start_state );
-        states_.insert( start_state );
-        start_state_ = start_state.get();
+        // States are numbered in the order that they're first reached in a 
+        // breadth first walk from the start state that visits the 
+        // transitions from each state in order of symbol index.  Each
+        // kernel is looked up in the table of kernels seen so far before a
+        // state is created for it so that a state is only created, and its 
+        // closure only derived, once for each distinct kernel.
+        //
+        // The states in each level of the walk are split between threads 
+        // that generate their goto kernels and look them up in the table 
+        // concurrently.  The states created by the threads are then 
+        // numbered, and transitions added, on this thread in the order of 
+        // the walk so that the states are the same for any number of 
+        // threads.
+        int threads = threads_ > 0 ? threads_ : ThreadPool::hardware_threads();
+        ThreadPool pool( threads - 1 );
+        GrammarKernelTable states( threads > 1 ? threads * 8 : 1 );
+        vector<vector<unique_ptr<GrammarState>>> created_states( threads );
 
-        set<const GrammarSymbol*, GrammarSymbolLess> lookahead_symbols;
-        lookahead_symbols.insert( (GrammarSymbol*) end_symbol );
-        start_state->add_lookahead_symbols( start_symbol->productions().front(), 0, lookahead_symbols );
-        
-        int added = 1;
-        while ( added > 0 )
+        GrammarKernel kernel;
+        kernel.add_item( start_symbol->productions().front(), 0 );
+        start_state_ = states.insert( kernel, &created_states[0] );
+        start_state_->set_index( 0 );
+        states_.push_back( std::move(created_states[0].back()) );
+        created_states[0].clear();
+
+        vector<vector<std::pair<const GrammarSymbol*, GrammarState*>>> transitions;
+        size_t begin = 0;
+        while ( begin < states_.size() )
         {
-            added = 0;
-            for ( std::set<std::shared_ptr<GrammarState>, GrammarStateLess>::const_iterator i = states_.begin(); i != states_.end(); ++i )
+            size_t end = states_.size();
+            transitions.clear();
+            transitions.resize( end - begin );
+            std::atomic<size_t> next_state( begin );
+            for ( int thread = 0; thread < threads; ++thread )
             {
-                const std::shared_ptr<GrammarState>& state = *i;
-                LALR_ASSERT( state );
-
-                if ( !state->processed() )
-                {
-                    state->set_processed( true );
-                    for ( vector<unique_ptr<GrammarSymbol>>::const_iterator j = symbols.begin(); j != symbols.end(); ++j )
+                vector<unique_ptr<GrammarState>>* thread_created_states = &created_states[thread];
+                pool.push( [this, begin, end, &next_state, &states, &transitions, thread_created_states] ()
                     {
-                        GrammarSymbol* symbol = j->get();
-                        LALR_ASSERT( symbol );
-                        if ( symbol != end_symbol )
+                        vector<std::pair<const GrammarSymbol*, GrammarKernel>> goto_kernels;
+                        for ( size_t i = next_state++; i < end; i = next_state++ )
                         {
-                            std::shared_ptr<GrammarState> goto_state = goto_( state, *symbol );
-                            if ( !goto_state->items().empty() )
-                            {                    
-                                std::shared_ptr<GrammarState> actual_goto_state = *states_.insert( goto_state ).first;
-                                added += goto_state == actual_goto_state ? 1 : 0;
-                                state->add_transition( symbol, actual_goto_state.get() );
+                            this->goto_kernels( states_[i].get(), &goto_kernels );
+                            vector<std::pair<const GrammarSymbol*, GrammarState*>>& state_transitions = transitions[i - begin];
+                            state_transitions.reserve( goto_kernels.size() );
+                            for ( vector<std::pair<const GrammarSymbol*, GrammarKernel>>::const_iterator j = goto_kernels.begin(); j != goto_kernels.end(); ++j )
+                            {
+                                LALR_ASSERT( j->first );
+                                state_transitions.push_back( std::make_pair(j->first, states.insert(j->second, thread_created_states)) );
                             }
                         }
                     }
-                }
+                );
             }
-        }
-        
-        generate_indices_for_states();
+            pool.wait();
 
-        added = 1;
-        while ( added > 0 )
-        {
-            added = 0;
-            for ( std::set<std::shared_ptr<GrammarState>, GrammarStateLess>::const_iterator i = states_.begin(); i != states_.end(); ++i )
+            for ( size_t i = begin; i < end; ++i )
             {
-                GrammarState* state = i->get();
+                GrammarState* state = states_[i].get();
                 LALR_ASSERT( state );
-                added += lookahead_closure( state );
-                added += lookahead_goto( state );
+                const vector<std::pair<const GrammarSymbol*, GrammarState*>>& state_transitions = transitions[i - begin];
+                for ( vector<std::pair<const GrammarSymbol*, GrammarState*>>::const_iterator j = state_transitions.begin(); j != state_transitions.end(); ++j )
+                {
+                    GrammarState* goto_state = j->second;
+                    LALR_ASSERT( goto_state );
+                    if ( goto_state->index() == GrammarState::INVALID_INDEX )
+                    {
+                        goto_state->set_index( int(states_.size()) );
+                        states_.push_back( nullptr );
+                    }
+                    state->add_transition( j->first, goto_state );
+                }
+            }
+
+            for ( vector<vector<unique_ptr<GrammarState>>>::iterator i = created_states.begin(); i != created_states.end(); ++i )
+            {
+                for ( vector<unique_ptr<GrammarState>>::iterator j = i->begin(); j != i->end(); ++j )
+                {
+                    GrammarState* state = j->get();
+                    LALR_ASSERT( state && state->index() >= int(end) && state->index() < int(states_.size()) );
+                    states_[state->index()] = std::move( *j );
+                }
+                i->clear();
+            }
+            begin = end;
+
+            // Parsers index states with 16 bits on their stack so grammars
+            // that generate more states than that are rejected here rather
+            // than silently producing a parser that can't run them.
+            if ( states_.size() > size_t(ParserStateMachine::MAXIMUM_STATES) )
+            {
+                fire_error( 1, 1, PARSER_ERROR_TOO_MANY_STATES, "Grammar '%s' generates more than %d states", identifier_.c_str(), ParserStateMachine::MAXIMUM_STATES );
+                return;
             }
         }
+
+        if ( lookahead_relations_enabled_ )
+        {
+            generate_lookaheads_from_relations();
+        }
+        else
+        {
+            propagate_lookaheads();
+        }
         
         generate_reduce_transitions();
         generate_indices_for_transitions();
@@ -697,17 +880,254 @@ void GrammarGenerator::generate_states( const GrammarSymbol* start_symbol, const
 }
 
 /**
-// Generate indices for states.
+// Propagate lookaheads between the items of each state and the items of 
+// the states that it transitions to until no more lookaheads are added.
 */
-void GrammarGenerator::generate_indices_for_states()
+void GrammarGenerator::propagate_lookaheads()
 {
-    int index = 0;
-    for ( std::set<std::shared_ptr<GrammarState>, GrammarStateLess>::iterator i = states_.begin(); i != states_.end(); ++i )
+    LALR_ASSERT( start_state_ );
+
+    GrammarSymbolSet lookahead_symbols;
+    lookahead_symbols.insert( end_symbol_ );
+    start_state_->add_lookahead_symbols( start_symbol_->productions().front(), 0, lookahead_symbols );
+
+    int added = 1;
+    while ( added > 0 )
     {
-        GrammarState* state = i->get();
-        LALR_ASSERT( state );
-        state->set_index( index );
-        ++index;
+        added = 0;
+        for ( vector<unique_ptr<GrammarState>>::const_iterator i = states_.begin(); i != states_.end(); ++i )
+        {
+            GrammarState* state = i->get();
+            LALR_ASSERT( state );
+            added += lookahead_closure( state );
+            added += lookahead_goto( state );
+        }
+    }
+}
+
+/**
+// Generate the lookaheads for the items with the dot at the end from the
+// DeRemer-Pennello relations between non-terminal transitions.
+//
+// The lookaheads of the reduction by a production in a state are the 
+// union of the follow sets of the non-terminal transitions that the 
+// reduction looks back to.  Follow sets are the closure over the 
+// *includes* relation of read sets that are, in turn, the closure over the
+// *reads* relation of the terminals shifted directly after each 
+// non-terminal transition (see "Efficient Computation of LALR(1) Look-Ahead
+// Sets", DeRemer and Pennello, 1982).  Each closure is a single pass of 
+// digraph() rather than repeated passes over every item in every state.
+//
+// Lookaheads aren't generated for items with the dot before the end as 
+// only reductions need them.
+*/
+void GrammarGenerator::generate_lookaheads_from_relations()
+{
+    LALR_ASSERT( start_state_ );
+
+    // Number the transitions in order of state and then symbol so that the
+    // transitions from a state are contiguous and sorted by symbol index.
+    // The accepting transition on the start symbol from the start state 
+    // doesn't exist in the state machine but is numbered last so that the 
+    // end symbol is read after it like any other non-terminal transition.
+    const vector<unique_ptr<GrammarState>>& states = states_;
+    vector<int> first_transitions( states.size() + 1 );
+    vector<const GrammarTransition*> transitions;
+    vector<int> sources;
+    for ( size_t i = 0; i < states.size(); ++i )
+    {
+        first_transitions[i] = int(transitions.size());
+        const set<GrammarTransition>& state_transitions = states[i]->transitions();
+        for ( set<GrammarTransition>::const_iterator transition = state_transitions.begin(); transition != state_transitions.end(); ++transition )
+        {
+            transitions.push_back( &(*transition) );
+            sources.push_back( int(i) );
+        }
+    }
+    first_transitions[states.size()] = int(transitions.size());
+    const int start_transition = int(transitions.size());
+    transitions.push_back( nullptr );
+    sources.push_back( start_state_->index() );
+
+    // Read the terminals shifted directly after each non-terminal transition
+    // and relate each non-terminal transition to the transitions on 
+    // nullable non-terminals from the state that it transitions to.
+    vector<GrammarSymbolSet> follow_sets( transitions.size() );
+    vector<vector<int>> reads( transitions.size() );
+    for ( int i = 0; i < start_transition; ++i )
+    {
+        const GrammarTransition* transition = transitions[i];
+        if ( transition->symbol()->symbol_type() == SYMBOL_NON_TERMINAL )
+        {
+            int state = transition->state()->index();
+            for ( int j = first_transitions[state]; j < first_transitions[state + 1]; ++j )
+            {
+                const GrammarSymbol* symbol = transitions[j]->symbol();
+                if ( symbol->symbol_type() != SYMBOL_NON_TERMINAL )
+                {
+                    follow_sets[i].insert( symbol );
+                }
+                else if ( symbol->nullable() )
+                {
+                    reads[i].push_back( j );
+                }
+            }
+        }
+    }
+    follow_sets[start_transition].insert( end_symbol_ );
+    digraph( reads, &follow_sets );
+
+    // Walk each production of the symbol of each non-terminal transition
+    // from the transition's source state.  A transition on a non-terminal 
+    // followed only by nullable symbols includes the walked transition and 
+    // the reduction by the production in the state at the end of the walk
+    // looks back to it.
+    vector<vector<int>> includes( transitions.size() );
+    vector<int> lookback_states;
+    vector<GrammarProduction*> lookback_productions;
+    vector<int> lookback_transitions;
+    for ( int i = 0; i <= start_transition; ++i )
+    {
+        const GrammarSymbol* symbol = i < start_transition ? transitions[i]->symbol() : start_symbol_;
+        if ( symbol->symbol_type() == SYMBOL_NON_TERMINAL )
+        {
+            const vector<GrammarProduction*>& productions = symbol->productions();
+            for ( vector<GrammarProduction*>::const_iterator j = productions.begin(); j != productions.end(); ++j )
+            {
+                GrammarProduction* production = *j;
+                LALR_ASSERT( production );
+                const vector<GrammarSymbol*>& symbols = production->symbols();
+                int nullable_suffix = int(symbols.size());
+                while ( nullable_suffix > 0 && symbols[nullable_suffix - 1]->nullable() )
+                {
+                    --nullable_suffix;
+                }
+
+                int state = sources[i];
+                for ( int k = 0; k < int(symbols.size()); ++k )
+                {
+                    int begin = first_transitions[state];
+                    int end = first_transitions[state + 1];
+                    int index = symbols[k]->index();
+                    while ( begin < end )
+                    {
+                        int middle = begin + (end - begin) / 2;
+                        if ( transitions[middle]->symbol()->index() < index )
+                        {
+                            begin = middle + 1;
+                        }
+                        else
+                        {
+                            end = middle;
+                        }
+                    }
+                    LALR_ASSERT( begin < first_transitions[state + 1] && transitions[begin]->symbol() == symbols[k] );
+                    if ( symbols[k]->symbol_type() == SYMBOL_NON_TERMINAL && k + 1 >= nullable_suffix )
+                    {
+                        includes[begin].push_back( i );
+                    }
+                    state = transitions[begin]->state()->index();
+                }
+
+                lookback_states.push_back( state );
+                lookback_productions.push_back( production );
+                lookback_transitions.push_back( i );
+            }
+        }
+    }
+    digraph( includes, &follow_sets );
+
+    for ( size_t i = 0; i < lookback_states.size(); ++i )
+    {
+        GrammarState* state = states[lookback_states[i]].get();
+        GrammarProduction* production = lookback_productions[i];
+        state->add_lookahead_symbols( production, production->length(), follow_sets[lookback_transitions[i]] );
+    }
+}
+
+/**
+// Close \e sets over \e relation.
+//
+// Unions the set of each element with the sets of the elements that it is 
+// related to, directly or indirectly, so that each element ends up with 
+// the union of the sets of every element reachable from it.  Elements in 
+// the same strongly connected component end up with the same set.  This is
+// the digraph algorithm from DeRemer and Pennello; it visits each element
+// and each edge once, using an explicit stack rather than recursion so 
+// that long chains of relations can't overflow the call stack.
+//
+// @param relation
+//  The elements that each element is related to.
+//
+// @param sets
+//  The set of each element, replaced by the closure of the sets over 
+//  \e relation (assumed not null and the same size as \e relation).
+*/
+void GrammarGenerator::digraph( const std::vector<std::vector<int>>& relation, std::vector<GrammarSymbolSet>* sets )
+{
+    LALR_ASSERT( sets );
+    LALR_ASSERT( sets->size() == relation.size() );
+
+    struct Frame
+    {
+        int element; ///< The element being visited.
+        int depth; ///< The depth of the stack when the element was first visited.
+        size_t edge; ///< The index of the next edge to visit from the element.
+    };
+
+    const int FINISHED = std::numeric_limits<int>::max();
+    vector<int> depths( relation.size(), 0 );
+    vector<int> stack;
+    vector<Frame> frames;
+    for ( size_t root = 0; root < relation.size(); ++root )
+    {
+        if ( depths[root] == 0 )
+        {
+            stack.push_back( int(root) );
+            depths[root] = int(stack.size());
+            Frame root_frame = { int(root), int(stack.size()), 0 };
+            frames.push_back( root_frame );
+            while ( !frames.empty() )
+            {
+                Frame& frame = frames.back();
+                int x = frame.element;
+                if ( frame.edge < relation[x].size() )
+                {
+                    int y = relation[x][frame.edge];
+                    if ( depths[y] == 0 )
+                    {
+                        stack.push_back( y );
+                        depths[y] = int(stack.size());
+                        Frame next_frame = { y, int(stack.size()), 0 };
+                        frames.push_back( next_frame );
+                    }
+                    else
+                    {
+                        depths[x] = std::min( depths[x], depths[y] );
+                        (*sets)[x].insert( (*sets)[y] );
+                        ++frame.edge;
+                    }
+                }
+                else
+                {
+                    if ( depths[x] == frame.depth )
+                    {
+                        int y = -1;
+                        while ( y != x )
+                        {
+                            y = stack.back();
+                            stack.pop_back();
+                            depths[y] = FINISHED;
+                            if ( y != x )
+                            {
+                                (*sets)[y] = (*sets)[x];
+                            }
+                        }
+                    }
+                    frames.pop_back();
+                }
+            }
+        }
     }
 }
 
@@ -716,7 +1136,7 @@ void GrammarGenerator::generate_indices_for_states()
 */
 void GrammarGenerator::generate_reduce_transitions()
 {
-    for ( std::set<std::shared_ptr<GrammarState>, GrammarStateLess>::const_iterator i = states_.begin(); i != states_.end(); ++i )
+    for ( vector<unique_ptr<GrammarState>>::const_iterator i = states_.begin(); i != states_.end(); ++i )
     {
         GrammarState* state = i->get();
         LALR_ASSERT( state );
@@ -725,11 +1145,12 @@ void GrammarGenerator::generate_reduce_transitions()
         {
             if ( item->dot_at_end() )
             {
-                const set<const GrammarSymbol*, GrammarSymbolLess>& symbols = item->lookahead_symbols();
-                for ( set<const GrammarSymbol*>::const_iterator j = symbols.begin(); j != symbols.end(); ++j )
+                const GrammarSymbolSet& symbols = item->lookahead_symbols();
+                for ( int j = symbols.next(0); j >= 0; j = symbols.next(j + 1) )
                 {
-                    const GrammarSymbol* symbol = *j;
-                    LALR_ASSERT( symbol );
+                    LALR_ASSERT( j < int(symbols_.size()) );
+                    const GrammarSymbol* symbol = symbols_[j].get();
+                    LALR_ASSERT( symbol && symbol->index() == j );
                     generate_reduce_transition( state, symbol, item->production() );
                 }
             }                
@@ -803,7 +1224,7 @@ void GrammarGenerator::generate_reduce_transition( GrammarState* state, const Gr
 */
 void GrammarGenerator::generate_indices_for_transitions()
 {
-    for ( std::set<std::shared_ptr<GrammarState>, GrammarStateLess>::const_iterator i = states_.begin(); i != states_.end(); ++i )
+    for ( vector<unique_ptr<GrammarState>>::const_iterator i = states_.begin(); i != states_.end(); ++i )
     {
         GrammarState* state = i->get();
         LALR_ASSERT( state );
@@ -2,12 +2,12 @@
 #define LALR_GRAMMARGENERATOR_HPP_INCLUDED
 
 #include "RegexToken.hpp"
-#include "GrammarSymbolLess.hpp"
-#include "GrammarStateLess.hpp"
+#include "GrammarSymbolSet.hpp"
+#include "GrammarKernel.hpp"
 #include <memory>
-#include <set>
 #include <vector>
 #include <string>
+#include <utility>
 
 namespace lalr
 {
@@ -34,28 +34,35 @@ class GrammarGenerator
     std::vector<std::unique_ptr<GrammarAction>> actions_; ///< The actions in the parser.
     std::vector<std::unique_ptr<GrammarProduction>> productions_; ///< The productions in the parser.
     std::vector<std::unique_ptr<GrammarSymbol>> symbols_; ///< The symbols in the parser.
-    std::set<std::shared_ptr<GrammarState>, GrammarStateLess> states_; ///< The states in the parser's state machine.
+    std::vector<std::unique_ptr<GrammarState>> states_; ///< The states in the parser's state machine in order of index.
     GrammarSymbol* start_symbol_; ///< The start symbol.
     GrammarSymbol* end_symbol_; ///< The end symbol.
     GrammarSymbol* error_symbol_; ///< The error symbol.
     GrammarState* start_state_; ///< The start state.
     int errors_; ///< The number of errors that occured during parsing and generation.
+    bool lookahead_relations_enabled_; ///< True if lookaheads are calculated from the DeRemer-Pennello relations otherwise false to propagate them between items until nothing changes.
+    int threads_; ///< The number of threads used to generate states or 0 to use as many as the hardware can run concurrently.
 
     public:
         GrammarGenerator();
         ~GrammarGenerator();
         const std::vector<std::unique_ptr<GrammarAction>>& actions() const;
         const std::vector<std::unique_ptr<GrammarSymbol>>& symbols() const;
-        const std::set<std::shared_ptr<GrammarState>, GrammarStateLess>& states() const;
+        const std::vector<std::unique_ptr<GrammarState>>& states() const;
         const GrammarState* start_state() const;
-        int generate( Grammar& grammar, ErrorPolicy* error_policy );
+        int generate_symbols( Grammar& grammar, ErrorPolicy* error_policy );
+        int generate_parser();
+        void set_lookahead_relations_enabled( bool lookahead_relations_enabled );
+        bool is_lookahead_relations_enabled() const;
+        void set_threads( int threads );
+        int threads() const;
                 
     private:
         void fire_error( int line, int column, int error, const char* format, ... );
         void fire_printf( const char* format, ... ) const;
-        std::set<const GrammarSymbol*, GrammarSymbolLess> lookahead( const GrammarItem& item ) const;
-        void closure( const std::shared_ptr<GrammarState>& state );
-        std::shared_ptr<GrammarState> goto_( const std::shared_ptr<GrammarState>& state, const GrammarSymbol& symbol );
+        GrammarSymbolSet lookahead( const GrammarItem& item ) const;
+        void closure( const GrammarState* state, std::vector<std::pair<GrammarProduction*, int>>* items ) const;
+        void goto_kernels( const GrammarState* state, std::vector<std::pair<const GrammarSymbol*, GrammarKernel>>* goto_kernels ) const;
         int lookahead_closure( GrammarState* state ) const;
         int lookahead_goto( GrammarState* state ) const;
         void replace_references_to_symbol( GrammarSymbol* to_symbol, GrammarSymbol* with_symbol );
@@ -69,8 +76,10 @@ class GrammarGenerator
         void calculate_symbol_indices();
         void calculate_first();
         void calculate_follow();
-        void generate_states( const GrammarSymbol* start_symbol, const GrammarSymbol* end_symbol, const std::vector<std::unique_ptr<GrammarSymbol>>& symbols );
-        void generate_indices_for_states();
+        void generate_states( const GrammarSymbol* start_symbol, const GrammarSymbol* end_symbol );
+        void propagate_lookaheads();
+        void generate_lookaheads_from_relations();
+        static void digraph( const std::vector<std::vector<int>>& relation, std::vector<GrammarSymbolSet>* sets );
         void generate_reduce_transitions();
         void generate_reduce_transition( GrammarState* state, const GrammarSymbol* symbol, const GrammarProduction* production );
         void generate_indices_for_transitions();
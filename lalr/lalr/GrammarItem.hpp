@@ -1,9 +1,8 @@
 #ifndef LALR_GRAMMARITEM_HPP_INCLUDED
 #define LALR_GRAMMARITEM_HPP_INCLUDED
 
-#include "GrammarSymbolLess.hpp"
+#include "GrammarSymbolSet.hpp"
 #include <string>
-#include <set>
 
 namespace lalr
 {
@@ -19,7 +18,7 @@ class GrammarItem
 {
     GrammarProduction* production_; ///< The production that this item is for.
     int position_; ///< The position of the dot in this item.
-    mutable std::set<const GrammarSymbol*, GrammarSymbolLess> lookahead_symbols_; ///< The lookahead Symbols for this item.
+    mutable GrammarSymbolSet lookahead_symbols_; ///< The lookahead Symbols for this item.
 
     public:
         GrammarItem();
@@ -29,9 +28,9 @@ class GrammarItem
         bool dot_at_beginning() const;
         bool dot_at_end() const;
         bool next_node( const GrammarSymbol& symbol ) const;
-        const std::set<const GrammarSymbol*, GrammarSymbolLess>& lookahead_symbols() const;
+        const GrammarSymbolSet& lookahead_symbols() const;
         bool operator<( const GrammarItem& item ) const;
-        int add_lookahead_symbols( const std::set<const GrammarSymbol*, GrammarSymbolLess>& lookahead_symbols ) const;
+        int add_lookahead_symbols( const GrammarSymbolSet& lookahead_symbols ) const;
 };
 
 }
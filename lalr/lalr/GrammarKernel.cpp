@@ -0,0 +1,101 @@
+//
+// GrammarKernel.cpp
+// Copyright (c) Charles Baker. All rights reserved.
+//
+
+#include "GrammarKernel.hpp"
+#include "GrammarProduction.hpp"
+#include "assert.hpp"
+
+using std::vector;
+using namespace lalr;
+
+/**
+// Constructor.
+*/
+GrammarKernel::GrammarKernel()
+: items_(),
+  hash_( 0 )
+{
+}
+
+/**
+// Get the items in this kernel.
+//
+// @return
+//  The production and dot position of each item in order of production
+//  index and then position.
+*/
+const std::vector<std::pair<GrammarProduction*, int>>& GrammarKernel::items() const
+{
+    return items_;
+}
+
+/**
+// Get the hash of the items in this kernel.
+//
+// @return
+//  The hash.
+*/
+std::size_t GrammarKernel::hash() const
+{
+    return hash_;
+}
+
+/**
+// Equality operator.
+//
+// @param kernel
+//  The kernel to compare this kernel with.
+//
+// @return
+//  True if this kernel has the same items as \e kernel otherwise false.
+*/
+bool GrammarKernel::operator==( const GrammarKernel& kernel ) const
+{
+    return hash_ == kernel.hash_ && items_ == kernel.items_;
+}
+
+/**
+// Add an item to this kernel.
+//
+// Items must be added in order of production index and then position.
+//
+// @param production
+//  The production of the item to add.
+//
+// @param position
+//  The position of the dot in the item to add.
+*/
+void GrammarKernel::add_item( GrammarProduction* production, int position )
+{
+    LALR_ASSERT( production );
+    LALR_ASSERT( position >= 0 && position <= production->length() );
+    LALR_ASSERT( items_.empty() || items_.back().first->index() < production->index() || (items_.back().first == production && items_.back().second < position) );
+    items_.push_back( std::make_pair(production, position) );
+    std::size_t value = std::size_t(production->index()) * 31 + std::size_t(position);
+    hash_ ^= value + 0x9e3779b9 + (hash_ << 6) + (hash_ >> 2);
+}
+
+/**
+// Remove all of the items from this kernel.
+*/
+void GrammarKernel::clear()
+{
+    items_.clear();
+    hash_ = 0;
+}
+
+/**
+// Hash \e kernel.
+//
+// @param kernel
+//  The kernel to hash.
+//
+// @return
+//  The hash of the items in \e kernel.
+*/
+std::size_t GrammarKernelHash::operator()( const GrammarKernel& kernel ) const
+{
+    return kernel.hash();
+}
@@ -0,0 +1,48 @@
+#ifndef LALR_GRAMMARKERNEL_HPP_INCLUDED
+#define LALR_GRAMMARKERNEL_HPP_INCLUDED
+
+#include <vector>
+#include <utility>
+#include <cstddef>
+
+namespace lalr
+{
+
+class GrammarProduction;
+
+/**
+// The kernel items of a state in a parser's state machine.
+//
+// States are identified by their kernel items alone as the rest of their
+// items are derived from the kernel by closure.  Items are kept in order of
+// production index and then position so that equal kernels have equal
+// items and the hash of the items is updated as each item is added so that
+// looking a kernel up in a hash table only compares items with the kernels
+// whose hashes match.
+*/
+class GrammarKernel
+{
+    std::vector<std::pair<GrammarProduction*, int>> items_; ///< The production and dot position of each item in this kernel.
+    std::size_t hash_; ///< The hash of the items in this kernel.
+
+public:
+    GrammarKernel();
+    const std::vector<std::pair<GrammarProduction*, int>>& items() const;
+    std::size_t hash() const;
+    bool operator==( const GrammarKernel& kernel ) const;
+    void add_item( GrammarProduction* production, int position );
+    void clear();
+};
+
+/**
+// Hash a kernel by returning its precalculated hash.
+*/
+class GrammarKernelHash
+{
+public:
+    std::size_t operator()( const GrammarKernel& kernel ) const;
+};
+
+}
+
+#endif
@@ -0,0 +1,67 @@
+//
+// GrammarKernelTable.cpp
+// Copyright (c) Charles Baker. All rights reserved.
+//
+
+#include "GrammarKernelTable.hpp"
+#include "GrammarState.hpp"
+#include "assert.hpp"
+
+using std::vector;
+using std::unique_ptr;
+using namespace lalr;
+
+/**
+// Constructor.
+//
+// @param shards
+//  The number of independently locked shards to split the table into
+//  (assumed > 0).
+*/
+GrammarKernelTable::GrammarKernelTable( int shards )
+: shards_(),
+  shards_size_( shards )
+{
+    LALR_ASSERT( shards_size_ > 0 );
+    shards_.reset( new Shard [shards_size_] );
+}
+
+/**
+// Find the state for \e kernel or create one if there isn't one yet.
+//
+// Safe to call from multiple threads at once.
+//
+// @param kernel
+//  The kernel to find or create the state for.
+//
+// @param created_states
+//  The states created by the calling thread to append the state to if it
+//  is created (assumed not null).
+//
+// @return
+//  The state for \e kernel.
+*/
+GrammarState* GrammarKernelTable::insert( const GrammarKernel& kernel, std::vector<std::unique_ptr<GrammarState>>* created_states )
+{
+    LALR_ASSERT( created_states );
+    LALR_ASSERT( !kernel.items().empty() );
+
+    Shard& shard = shards_[kernel.hash() % size_t(shards_size_)];
+    std::lock_guard<std::mutex> lock( shard.mutex );
+    std::unordered_map<GrammarKernel, GrammarState*, GrammarKernelHash>::const_iterator i = shard.states.find( kernel );
+    if ( i != shard.states.end() )
+    {
+        return i->second;
+    }
+
+    unique_ptr<GrammarState> state( new GrammarState() );
+    const vector<std::pair<GrammarProduction*, int>>& items = kernel.items();
+    for ( vector<std::pair<GrammarProduction*, int>>::const_iterator item = items.begin(); item != items.end(); ++item )
+    {
+        state->add_item( item->first, item->second );
+    }
+    GrammarState* created_state = state.get();
+    shard.states.insert( std::make_pair(kernel, created_state) );
+    created_states->push_back( std::move(state) );
+    return created_state;
+}
@@ -0,0 +1,42 @@
+#ifndef LALR_GRAMMARKERNELTABLE_HPP_INCLUDED
+#define LALR_GRAMMARKERNELTABLE_HPP_INCLUDED
+
+#include "GrammarKernel.hpp"
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace lalr
+{
+
+class GrammarState;
+
+/**
+// @internal
+//
+// The states in a parser's state machine keyed by their kernels.
+//
+// The table is split into shards, selected by the hash of each kernel,
+// that each have their own lock so that threads generating states
+// concurrently only contend when they look up kernels in the same shard.
+*/
+class GrammarKernelTable
+{
+    struct Shard
+    {
+        std::mutex mutex; ///< Guards states.
+        std::unordered_map<GrammarKernel, GrammarState*, GrammarKernelHash> states; ///< The states in this shard keyed by kernel.
+    };
+
+    std::unique_ptr<Shard[]> shards_; ///< The shards of this table.
+    int shards_size_; ///< The number of shards in this table.
+
+public:
+    GrammarKernelTable( int shards );
+    GrammarState* insert( const GrammarKernel& kernel, std::vector<std::unique_ptr<GrammarState>>* created_states );
+};
+
+}
+
+#endif
@@ -18,7 +18,6 @@ using namespace lalr;
 GrammarState::GrammarState()
 : items_(),
   transitions_(),
-  processed_( false ),
   index_( INVALID_INDEX )
 {
 }
@@ -27,7 +26,8 @@ GrammarState::GrammarState()
 // Get the items in this state.
 //
 // @return
-//  The items.
+//  The kernel items of this state and the items derived from them by 
+//  closure that lookaheads have been added to.
 */
 const std::set<GrammarItem>& GrammarState::items() const
 {
@@ -72,17 +72,6 @@ const std::set<GrammarTransition>& GrammarState::transitions() const
     return transitions_;
 }
 
-/**
-// Has this state been processed?
-//
-// @return
-//  True if this state has been processed otherwise false.
-*/
-bool GrammarState::processed() const
-{
-    return processed_;
-}
-
 /**
 // Get the index of this state.
 //
@@ -94,20 +83,6 @@ int GrammarState::index() const
     return index_;
 }
 
-/**
-// Less than operator.
-//
-// @param state
-//  The state to compare this state with.
-//
-// @return
-//  True if the items in this state are less than the items in \e state.
-*/
-bool GrammarState::operator<( const GrammarState& state ) const
-{
-    return std::lexicographical_compare( items_.begin(), items_.end(), state.items_.begin(), state.items_.end() );
-}
-
 /**
 // Add an item to this state.
 //
@@ -130,6 +105,10 @@ int GrammarState::add_item( GrammarProduction* production, int position )
 // Add the symbols in *lookahead_symbols* to the item in this state for 
 // *production* at *position*.
 //
+// Items with the dot at the beginning are derived by closure rather than 
+// stored and so are added to this state the first time that lookaheads
+// are added to them.
+//
 // @param production
 //  The production of the item to add *lookahead_symbols* to.
 //
@@ -140,13 +119,21 @@ int GrammarState::add_item( GrammarProduction* production, int position )
 //  The lookahead symbols to add to the item in this state.
 //
 // @return
-//  The number of lookahead symbols added.
+//  1 if any lookahead symbols were added otherwise 0.
 */
-int GrammarState::add_lookahead_symbols( GrammarProduction* production, int position, const std::set<const GrammarSymbol*, GrammarSymbolLess>& lookahead_symbols )
+int GrammarState::add_lookahead_symbols( GrammarProduction* production, int position, const GrammarSymbolSet& lookahead_symbols )
 {
     LALR_ASSERT( production );
     std::set<GrammarItem>::iterator item = items_.find( GrammarItem(production, position) );
-    LALR_ASSERT( item != items_.end() );
+    if ( item == items_.end() )
+    {
+        LALR_ASSERT( position == 0 );
+        if ( lookahead_symbols.empty() )
+        {
+            return 0;
+        }
+        item = items_.insert( GrammarItem(production, position) ).first;
+    }
     return item->add_lookahead_symbols( lookahead_symbols );
 }
 
@@ -203,37 +190,6 @@ void GrammarState::add_transition( const GrammarSymbol* symbol, const GrammarSym
     }
 }
 
-/**
-// Add a reduction to \e production from this state on any of the symbols in 
-// \e symbols.
-//
-// @param symbols
-//  The symbols to make the reduction on.
-//
-// @param reduced_symbol
-//  The symbol that is reduced to.
-//
-// @param reduced_length
-//  The number of symbols on the right-hand side of the production that is
-//  reduced.
-//
-// @param action
-//  The index of the action taken on the reduction or 
-//  `Action::INVALID_INDEX` if no action is taken.
-*/
-void GrammarState::add_transition( const std::set<const GrammarSymbol*, GrammarSymbolLess>& symbols, const GrammarSymbol* reduced_symbol, int reduced_length, int precedence, int action )
-{
-    LALR_ASSERT( reduced_symbol );
-    LALR_ASSERT( reduced_length >= 0 );
-    LALR_ASSERT( precedence >= 0 );
-    for ( set<const GrammarSymbol*>::const_iterator i = symbols.begin(); i != symbols.end(); ++i )
-    {
-        const GrammarSymbol* symbol = *i;
-        LALR_ASSERT( symbol );
-        add_transition( symbol, reduced_symbol, reduced_length, precedence, action );
-    }
-}
-
 /**
 // Find a transition on \e symbol from this state.
 //
@@ -274,17 +230,6 @@ void GrammarState::generate_indices_for_transitions()
     }
 }
 
-/**
-// Set this state as having been processed.
-//
-// @param processed
-//  True to mark this state as processed or false to mark it as not processed.
-*/
-void GrammarState::set_processed( bool processed )
-{
-    processed_ = processed;
-}
-
 /**
 // Set the index of this state.
 //
@@ -8,7 +8,6 @@
 #include "assert.hpp"
 #include <memory>
 
-using std::set;
 using std::vector;
 using std::shared_ptr;
 using namespace lalr;
@@ -74,12 +73,12 @@ bool GrammarSymbol::nullable() const
     return nullable_;
 }
 
-const std::set<const GrammarSymbol*, GrammarSymbolLess>& GrammarSymbol::first() const
+const GrammarSymbolSet& GrammarSymbol::first() const
 {
     return first_;
 }
 
-const std::set<const GrammarSymbol*, GrammarSymbolLess>& GrammarSymbol::follow() const
+const GrammarSymbolSet& GrammarSymbol::follow() const
 {
     return follow_;
 }
@@ -403,7 +402,7 @@ void GrammarSymbol::replace_by_non_terminal( const GrammarSymbol* non_terminal_s
 int GrammarSymbol::add_symbol_to_first( const GrammarSymbol* symbol )
 {
     LALR_ASSERT( symbol );
-    return first_.insert( symbol ).second ? 1 : 0;
+    return first_.insert( symbol ) ? 1 : 0;
 }
 
 /**
@@ -413,13 +412,11 @@ int GrammarSymbol::add_symbol_to_first( const GrammarSymbol* symbol )
 //  The symbols to add to the first set of this symbol.
 //
 // @return
-//  The number of symbols added.
+//  1 if any symbols were added otherwise 0.
 */
-int GrammarSymbol::add_symbols_to_first( const std::set<const GrammarSymbol*, GrammarSymbolLess>& symbols )
+int GrammarSymbol::add_symbols_to_first( const GrammarSymbolSet& symbols )
 {
-    size_t original_size = first_.size();
-    first_.insert( symbols.begin(), symbols.end() );
-    return int(first_.size() - original_size);
+    return first_.insert( symbols ) ? 1 : 0;
 }
 
 /**
@@ -434,7 +431,7 @@ int GrammarSymbol::add_symbols_to_first( const std::set<const GrammarSymbol*, Gr
 int GrammarSymbol::add_symbol_to_follow( const GrammarSymbol* symbol )
 {
     LALR_ASSERT( symbol );
-    return follow_.insert( symbol ).second ? 1 : 0;
+    return follow_.insert( symbol ) ? 1 : 0;
 }
 
 /**
@@ -444,13 +441,11 @@ int GrammarSymbol::add_symbol_to_follow( const GrammarSymbol* symbol )
 //  The symbols to add to the follow set of this symbol.
 //
 // @return
-//  The number of symbols added.
+//  1 if any symbols were added otherwise 0.
 */
-int GrammarSymbol::add_symbols_to_follow( const std::set<const GrammarSymbol*, GrammarSymbolLess>& symbols )
+int GrammarSymbol::add_symbols_to_follow( const GrammarSymbolSet& symbols )
 {
-    size_t original_size = follow_.size();
-    follow_.insert( symbols.begin(), symbols.end() );
-    return int(follow_.size() - original_size);
+    return follow_.insert( symbols ) ? 1 : 0;
 }
 
 /**
@@ -1,13 +1,12 @@
 #ifndef LALR_GRAMMARSYMBOL_HPP_INCLUDED
 #define LALR_GRAMMARSYMBOL_HPP_INCLUDED
 
-#include "GrammarSymbolLess.hpp"
+#include "GrammarSymbolSet.hpp"
 #include "SymbolType.hpp"
 #include "LexemeType.hpp"
 #include "Associativity.hpp"
 #include <string>
 #include <vector>
-#include <set>
 
 namespace lalr
 {
@@ -25,8 +24,8 @@ class GrammarSymbol
     int line_;
     int index_;
     bool nullable_; ///< True if this symbol is nullable otherwise false.
-    std::set<const GrammarSymbol*, GrammarSymbolLess> first_; ///< The symbols that can start this symbol in a production or regular expression.
-    std::set<const GrammarSymbol*, GrammarSymbolLess> follow_; ///< The symbols that can follow this symbol in a production or regular expression.
+    GrammarSymbolSet first_; ///< The symbols that can start this symbol in a production or regular expression.
+    GrammarSymbolSet follow_; ///< The symbols that can follow this symbol in a production or regular expression.
     std::vector<GrammarProduction*> productions_; ///< The productions that reduce to this symbol.
 
 public:
@@ -41,8 +40,8 @@ public:
     int line() const;
     int index() const;
     bool nullable() const;
-    const std::set<const GrammarSymbol*, GrammarSymbolLess>& first() const;
-    const std::set<const GrammarSymbol*, GrammarSymbolLess>& follow() const;
+    const GrammarSymbolSet& first() const;
+    const GrammarSymbolSet& follow() const;
     const std::vector<GrammarProduction*>& productions() const;
     GrammarSymbol* implicit_terminal() const;
     bool matches( const std::string& lexeme, SymbolType symbol_type ) const;
@@ -60,9 +59,9 @@ public:
     void calculate_identifier();
     void replace_by_non_terminal( const GrammarSymbol* non_terminal_symbol );    
     int add_symbol_to_first( const GrammarSymbol* symbol );
-    int add_symbols_to_first( const std::set<const GrammarSymbol*, GrammarSymbolLess>& symbols );
+    int add_symbols_to_first( const GrammarSymbolSet& symbols );
     int add_symbol_to_follow( const GrammarSymbol* symbol );
-    int add_symbols_to_follow( const std::set<const GrammarSymbol*, GrammarSymbolLess>& symbols );
+    int add_symbols_to_follow( const GrammarSymbolSet& symbols );
     int calculate_first();
     int calculate_follow();
 };
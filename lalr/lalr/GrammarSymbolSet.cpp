@@ -0,0 +1,164 @@
+//
+// GrammarSymbolSet.cpp
+// Copyright (c) Charles Baker. All rights reserved.
+//
+
+#include "GrammarSymbolSet.hpp"
+#include "GrammarSymbol.hpp"
+#include "assert.hpp"
+
+using std::uint64_t;
+using namespace lalr;
+
+/**
+// Constructor.
+*/
+GrammarSymbolSet::GrammarSymbolSet()
+: words_()
+{
+}
+
+/**
+// Constructor.
+//
+// @param symbols
+//  The number of symbols to reserve space for.
+*/
+GrammarSymbolSet::GrammarSymbolSet( int symbols )
+: words_()
+{
+    LALR_ASSERT( symbols >= 0 );
+    words_.reserve( (symbols + BITS_PER_WORD - 1) / BITS_PER_WORD );
+}
+
+/**
+// Is this set empty?
+//
+// @return
+//  True if this set contains no symbols otherwise false.
+*/
+bool GrammarSymbolSet::empty() const
+{
+    for ( std::vector<uint64_t>::const_iterator i = words_.begin(); i != words_.end(); ++i )
+    {
+        if ( *i != 0 )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+// Does this set contain \e symbol?
+//
+// @param symbol
+//  The symbol to check for (assumed not null).
+//
+// @return
+//  True if \e symbol is in this set otherwise false.
+*/
+bool GrammarSymbolSet::contains( const GrammarSymbol* symbol ) const
+{
+    LALR_ASSERT( symbol );
+    LALR_ASSERT( symbol->index() >= 0 );
+    size_t word = size_t(symbol->index() / BITS_PER_WORD);
+    return word < words_.size() && (words_[word] & (uint64_t(1) << (symbol->index() % BITS_PER_WORD))) != 0;
+}
+
+/**
+// Find the next symbol in this set at or after \e index.
+//
+// Iterate over the symbols in a set in order of index with:
+//
+// ~~~c++
+// for ( int index = symbols.next(0); index >= 0; index = symbols.next(index + 1) )
+// ~~~
+//
+// @param index
+//  The index to start searching from.
+//
+// @return
+//  The index of the next symbol in this set or -1 if there are no more 
+//  symbols.
+*/
+int GrammarSymbolSet::next( int index ) const
+{
+    LALR_ASSERT( index >= 0 );
+    size_t word = size_t(index / BITS_PER_WORD);
+    if ( word < words_.size() )
+    {
+        uint64_t bits = words_[word] >> (index % BITS_PER_WORD);
+        while ( bits == 0 )
+        {
+            ++word;
+            if ( word == words_.size() )
+            {
+                return -1;
+            }
+            bits = words_[word];
+            index = int(word) * BITS_PER_WORD;
+        }
+        while ( (bits & 1) == 0 )
+        {
+            bits >>= 1;
+            ++index;
+        }
+        return index;
+    }
+    return -1;
+}
+
+/**
+// Add \e symbol to this set.
+//
+// @param symbol
+//  The symbol to add (assumed not null).
+//
+// @return
+//  True if \e symbol was added or false if it was already in this set.
+*/
+bool GrammarSymbolSet::insert( const GrammarSymbol* symbol )
+{
+    LALR_ASSERT( symbol );
+    LALR_ASSERT( symbol->index() >= 0 );
+    size_t word = size_t(symbol->index() / BITS_PER_WORD);
+    if ( word >= words_.size() )
+    {
+        words_.resize( word + 1, 0 );
+    }
+    uint64_t bit = uint64_t(1) << (symbol->index() % BITS_PER_WORD);
+    bool added = (words_[word] & bit) == 0;
+    words_[word] |= bit;
+    return added;
+}
+
+/**
+// Add the symbols in \e symbols to this set.
+//
+// @param symbols
+//  The symbols to add.
+//
+// @return
+//  True if any symbols were added or false if all of \e symbols were 
+//  already in this set.
+*/
+bool GrammarSymbolSet::insert( const GrammarSymbolSet& symbols )
+{
+    size_t size = symbols.words_.size();
+    if ( words_.size() < size )
+    {
+        words_.resize( size, 0 );
+    }
+
+    uint64_t* words = words_.data();
+    const uint64_t* other_words = symbols.words_.data();
+    uint64_t added = 0;
+    for ( size_t i = 0; i < size; ++i )
+    {
+        uint64_t word = words[i] | other_words[i];
+        added |= word ^ words[i];
+        words[i] = word;
+    }
+    return added != 0;
+}
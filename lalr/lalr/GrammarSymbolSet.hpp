@@ -0,0 +1,39 @@
+#ifndef LALR_GRAMMARSYMBOLSET_HPP_INCLUDED
+#define LALR_GRAMMARSYMBOLSET_HPP_INCLUDED
+
+#include <vector>
+#include <cstdint>
+
+namespace lalr
+{
+
+class GrammarSymbol;
+
+/**
+// A set of symbols stored as a bitset indexed by symbol index.
+//
+// Used for first, follow, and lookahead sets during parser generation where
+// the same sets are repeatedly merged until a fixpoint is reached.  Merging
+// is a single pass over the words of each set that reports whether or not
+// any bits were added.  Symbols must have their indices calculated before 
+// they're added to a set.
+*/
+class GrammarSymbolSet
+{
+    std::vector<std::uint64_t> words_; ///< The bits of the set; bit (i % 64) of word (i / 64) is set if the symbol with index i is in the set.
+
+public:
+    static const int BITS_PER_WORD = 64;
+
+    GrammarSymbolSet();
+    GrammarSymbolSet( int symbols );
+    bool empty() const;
+    bool contains( const GrammarSymbol* symbol ) const;
+    int next( int index ) const;
+    bool insert( const GrammarSymbol* symbol );
+    bool insert( const GrammarSymbolSet& symbols );
+};
+
+}
+
+#endif
@@ -2,8 +2,10 @@
 #define LALR_LEXER_HPP_INCLUDED
 
 #include "PositionIterator.hpp"
+#include "PositionIndex.hpp"
 #include <vector>
 #include <functional>
+#include <type_traits>
 
 namespace lalr
 {
@@ -12,6 +14,7 @@ class ErrorPolicy;
 class LexerAction;
 class LexerTransition;
 class LexerState;
+class LexerLoop;
 class LexerStateMachine;
 
 /**
@@ -32,34 +35,63 @@ class Lexer
     const LexerStateMachine* state_machine_; ///< The state machine for this lexer.
     const LexerStateMachine* whitespace_state_machine_; ///< The whitespace state machine for this lexer.
     const void* end_symbol_; ///< The value to return to indicate that the end of the input has been reached.
+    const void* skip_symbol_; ///< The symbol matched by whitespace folded into the state machine for this lexer or null if there is no such symbol.
     ErrorPolicy* error_policy_; ///< The error policy this lexer uses to report errors and debug information.
     std::vector<LexerActionHandler> action_handlers_; ///< The action handlers for this Lexer.
     PositionIterator<Iterator> position_; ///< The current position of this Lexer in its input sequence.
+    PositionIndex<Char> positions_; ///< The index that resolves lexeme positions to lines and columns when positions are lazy.
+    bool lazy_positions_enabled_; ///< True if line and column numbers should be resolved on demand for contiguous input otherwise false.
+    bool lazy_positions_; ///< True if line and column numbers are being resolved on demand for the current input otherwise false.
     Iterator end_; ///< One past the last position of the input sequence for this Lexer.
-    std::basic_string<Char, Traits, Allocator> lexeme_; ///< The most recently matched lexeme.
+    mutable std::basic_string<Char, Traits, Allocator> lexeme_; ///< The most recently matched lexeme (only up to lexeme_tail_ until it is materialized).
+    Iterator lexeme_begin_; ///< The position of the first character of the most recently matched lexeme.
+    Iterator lexeme_tail_; ///< The position of the first character of the most recently matched lexeme that isn't yet in lexeme_.
+    Iterator lexeme_end_; ///< One past the position of the last character of the most recently matched lexeme.
+    bool lexeme_contiguous_; ///< True when the most recently matched lexeme is exactly [lexeme_begin_, lexeme_end_) otherwise false.
+    mutable bool lexeme_materialized_; ///< True when [lexeme_tail_, lexeme_end_) has been appended to lexeme_ otherwise false.
     int line_; ///< The line number at the start of the most recently matched lexeme.
     int column_; ///< The column number at the start of the most recently matched lexeme.
     const void* symbol_; ///< The most recently matched symbol or null if no symbol has been matched.
     bool full_; ///< True when this Lexer scanned all of its input otherwise false.
+    bool final_; ///< True when the current input is the last of the input otherwise false while more input is to be fed.
+    bool suspended_; ///< True when the most recent advance reached the end of input that isn't final before matching a token otherwise false.
+    const LexerState* skip_state_; ///< The whitespace state to resume skipping from when suspended while skipping whitespace otherwise null.
+    const LexerState* run_state_; ///< The state to resume matching from when suspended while matching a token otherwise null.
 
     public:
         Lexer( const LexerStateMachine* state_machine, const LexerStateMachine* whitespace_state_machine = nullptr, const void* end_symbol = nullptr, ErrorPolicy* error_policy = nullptr );
         void set_action_handler( const char* identifier, LexerActionFunction function );
         const std::basic_string<Char, Traits, Allocator>& lexeme() const;
+        bool lexeme_range( const Char** begin, const Char** end ) const;
         int line() const;
         int column() const;
+        const PositionIndex<Char>* positions() const;
+        const Char* lexeme_position() const;
         const void* symbol() const;
         const Iterator& position() const;
         bool full() const;
-        void reset( Iterator start, Iterator finish );
+        bool suspended() const;
+        void reset( Iterator start, Iterator finish, bool final = true );
+        void feed( Iterator start, Iterator finish );
+        void finish();
         void advance();
+        void set_lazy_positions_enabled( bool lazy_positions_enabled );
+        bool is_lazy_positions_enabled() const;
         
     private:
         void skip();
         const void* run();
+        void scan( const LexerLoop* loop );
         void error();
         void fire_error( int line, int column, int error, const char* format, ... ) const;
-        const LexerTransition* find_transition_by_character( const LexerState* state, int character ) const;
+        const LexerTransition* find_transition_by_character( const LexerStateMachine* state_machine, const LexerState* state, int character ) const;
+        static bool loops( const LexerLoop* loop, int character );
+        static Iterator scan( const LexerLoop* loop, Iterator position, Iterator end, std::true_type bytes );
+        static Iterator scan( const LexerLoop* loop, Iterator position, Iterator end, std::false_type bytes );
+        static bool lexeme_range( const Iterator& lexeme_begin, const Iterator& lexeme_end, const Char** begin, const Char** end, std::true_type contiguous );
+        static bool lexeme_range( const Iterator& lexeme_begin, const Iterator& lexeme_end, const Char** begin, const Char** end, std::false_type contiguous );
+        static const Char* address( const Iterator& position, std::true_type contiguous );
+        static const Char* address( const Iterator& position, std::false_type contiguous );
 };
 
 }
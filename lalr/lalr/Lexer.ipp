@@ -6,9 +6,11 @@
 #include "LexerState.hpp"
 #include "LexerTransition.hpp"
 #include "LexerStateMachine.hpp"
+#include "LexerLoop.hpp"
 #include "ErrorPolicy.hpp"
 #include "ErrorCode.hpp"
 #include "assert.hpp"
+#include "simd.hpp"
 #include <string.h>
 
 namespace lalr
@@ -51,15 +53,28 @@ Lexer<Iterator, Char, Traits, Allocator>::Lexer( const LexerStateMachine* state_
 : state_machine_( state_machine ),
   whitespace_state_machine_( whitespace_state_machine ),
   end_symbol_( end_symbol ),
+  skip_symbol_( state_machine ? state_machine->skip_symbol : nullptr ),
   error_policy_( error_policy ),
   action_handlers_(),
   position_(),
+  positions_(),
+  lazy_positions_enabled_( false ),
+  lazy_positions_( false ),
   end_(),
   lexeme_(),
+  lexeme_begin_(),
+  lexeme_tail_(),
+  lexeme_end_(),
+  lexeme_contiguous_( false ),
+  lexeme_materialized_( true ),
   line_( 0 ),
   column_ ( 1 ),
   symbol_( NULL ),
-  full_( false )
+  full_( false ),
+  final_( true ),
+  suspended_( false ),
+  skip_state_( nullptr ),
+  run_state_( nullptr )
 {
     if ( state_machine_ )
     {
@@ -118,15 +133,51 @@ void Lexer<Iterator, Char, Traits, Allocator>::set_action_handler( const char* i
 /**
 // Get the most recently scanned lexeme.
 //
+// The lexeme is copied from the input the first time that it is requested
+// after each token is matched.
+//
 // @return
 //  The lexeme.
 */
 template <class Iterator, class Char, class Traits, class Allocator>
 const std::basic_string<Char, Traits, Allocator>& Lexer<Iterator, Char, Traits, Allocator>::lexeme() const
 {
+    if ( !lexeme_materialized_ )
+    {
+        lexeme_.append( lexeme_tail_, lexeme_end_ );
+        lexeme_materialized_ = true;
+    }
     return lexeme_;
 }
 
+/**
+// Get the most recently scanned lexeme as a range of the input.
+//
+// This is only possible when the input is a contiguous sequence of 
+// characters (Iterator converts to const Char*) and no lexer action has 
+// rewritten the lexeme.  The range remains valid for as long as the input 
+// does.
+//
+// @param begin
+//  A variable to receive the first character of the lexeme (assumed not 
+//  null).
+//
+// @param end
+//  A variable to receive one past the last character of the lexeme 
+//  (assumed not null).
+//
+// @return
+//  True if [\e begin, \e end) was set to the lexeme otherwise false.
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+bool Lexer<Iterator, Char, Traits, Allocator>::lexeme_range( const Char** begin, const Char** end ) const
+{
+    LALR_ASSERT( begin );
+    LALR_ASSERT( end );
+    typedef typename std::is_convertible<Iterator, const Char*>::type contiguous;
+    return lexeme_contiguous_ && lexeme_range( lexeme_begin_, lexeme_end_, begin, end, contiguous() );
+}
+
 /**
 // Get the line number at the start of the most recently matched lexeme.
 //
@@ -136,6 +187,13 @@ const std::basic_string<Char, Traits, Allocator>& Lexer<Iterator, Char, Traits,
 template <class Iterator, class Char, class Traits, class Allocator>
 int Lexer<Iterator, Char, Traits, Allocator>::line() const
 {
+    if ( lazy_positions_ )
+    {
+        int line = 0;
+        int column = 0;
+        positions_.resolve( lexeme_position(), &line, &column );
+        return line;
+    }
     return line_;
 }
 
@@ -148,9 +206,45 @@ int Lexer<Iterator, Char, Traits, Allocator>::line() const
 template <class Iterator, class Char, class Traits, class Allocator>
 int Lexer<Iterator, Char, Traits, Allocator>::column() const
 {
+    if ( lazy_positions_ )
+    {
+        int line = 0;
+        int column = 0;
+        positions_.resolve( lexeme_position(), &line, &column );
+        return column;
+    }
     return column_;
 }
 
+/**
+// Get the index that resolves positions in the current input to line and
+// column numbers.
+//
+// @return
+//  The index or null if line and column numbers are being counted as the 
+//  input is scanned.
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+const PositionIndex<Char>* Lexer<Iterator, Char, Traits, Allocator>::positions() const
+{
+    return lazy_positions_ ? &positions_ : nullptr;
+}
+
+/**
+// Get the position in the input of the start of the most recently matched
+// lexeme.
+//
+// @return
+//  The position or null if the input isn't a contiguous sequence of 
+//  characters.
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+const Char* Lexer<Iterator, Char, Traits, Allocator>::lexeme_position() const
+{
+    typedef typename std::is_convertible<Iterator, const Char*>::type contiguous;
+    return address( lexeme_begin_, contiguous() );
+}
+
 /**
 // Get the most recently scanned symbol.
 //
@@ -187,6 +281,20 @@ bool Lexer<Iterator, Char, Traits, Allocator>::full() const
     return full_;
 }
 
+/**
+// Did the most recent advance stop at the end of input that isn't final 
+// without matching a token?
+//
+// @return
+//  True if this Lexer needs more input from Lexer::feed() or 
+//  Lexer::finish() before it can match the next token otherwise false.
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+bool Lexer<Iterator, Char, Traits, Allocator>::suspended() const
+{
+    return suspended_;
+}
+
 /**
 // Reset this %Lexer to scan [\e start, \e finish) starting its line count 
 // from \e line.
@@ -196,22 +304,119 @@ bool Lexer<Iterator, Char, Traits, Allocator>::full() const
 //
 // @param finish
 //  One past the last character in the input to scan.
+//
+// @param final
+//  True if [\e start, \e finish) is all of the input or false if more 
+//  input is to be passed to Lexer::feed() followed by a call to 
+//  Lexer::finish().
 */
 template <class Iterator, class Char, class Traits, class Allocator>
-void Lexer<Iterator, Char, Traits, Allocator>::reset( Iterator start, Iterator finish )
+void Lexer<Iterator, Char, Traits, Allocator>::reset( Iterator start, Iterator finish, bool final )
 {
     lexeme_.clear();
+    lexeme_begin_ = start;
+    lexeme_tail_ = start;
+    lexeme_end_ = start;
+    lexeme_contiguous_ = false;
+    lexeme_materialized_ = true;
     line_ = 0;
     column_ = 0;
-    position_ = PositionIterator<Iterator>( start, finish );
+    typedef typename std::is_convertible<Iterator, const Char*>::type contiguous;
+    lazy_positions_ = lazy_positions_enabled_ && contiguous::value && final;
+    if ( lazy_positions_ )
+    {
+        positions_.reset( address(start, contiguous()), address(finish, contiguous()) );
+    }
+    position_ = PositionIterator<Iterator>( start, finish, !lazy_positions_ );
     end_ = finish;
     symbol_ = NULL;
     full_ = false;
+    final_ = final;
+    suspended_ = false;
+    skip_state_ = nullptr;
+    run_state_ = nullptr;
+}
+
+/**
+// Continue scanning streamed input with the next part of that input.
+//
+// The whitespace or token that was being matched when the previous part
+// of the input ran out is resumed from the state that it reached and the
+// part of the lexeme already matched is kept so that tokens split across
+// parts are matched as if the input were contiguous.  The previous part
+// of the input isn't referenced after this call and so needn't remain 
+// valid.  Lexer actions only see the part of the input that they are 
+// called in.
+//
+// @param start
+//  The first character in the next part of the input.
+//
+// @param finish
+//  One past the last character in the next part of the input.
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+void Lexer<Iterator, Char, Traits, Allocator>::feed( Iterator start, Iterator finish )
+{
+    LALR_ASSERT( !final_ );
+    position_.resume( start, finish );
+    end_ = finish;
+    lexeme_begin_ = start;
+    lexeme_tail_ = start;
+    lexeme_end_ = start;
+}
+
+/**
+// Mark the end of streamed input.
+//
+// The next advance matches the end of any token that was suspended at the
+// end of the last part of the input and then the end symbol.
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+void Lexer<Iterator, Char, Traits, Allocator>::finish()
+{
+    final_ = true;
+}
+
+/**
+// Enable or disable resolving line and column numbers on demand.
+//
+// When enabled and the input is a contiguous sequence of characters this
+// %Lexer only tracks its position in the input as it scans.  Line and 
+// column numbers are resolved from an index of the line breaks in the 
+// input that is built the first time that they are requested.  Otherwise
+// line and column numbers are counted for every character scanned.  Takes 
+// effect from the next call to Lexer::reset().
+//
+// @param lazy_positions_enabled
+//  True to resolve line and column numbers on demand or false to count 
+//  them while scanning.
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+void Lexer<Iterator, Char, Traits, Allocator>::set_lazy_positions_enabled( bool lazy_positions_enabled )
+{
+    lazy_positions_enabled_ = lazy_positions_enabled;
+}
+
+/**
+// Are line and column numbers resolved on demand?
+//
+// @return
+//  True if line and column numbers are resolved on demand for contiguous
+//  input otherwise false.
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+bool Lexer<Iterator, Char, Traits, Allocator>::is_lazy_positions_enabled() const
+{
+    return lazy_positions_enabled_;
 }
 
 /**
 // Advance one token in the input stream.
 //
+// Whitespace matched by the skip symbol of a state machine that has had
+// whitespace folded into it is skipped over here by matching again until
+// some other token is matched.
+//
 // @param data
 //  The data that defines the state machine that is used in matching 
 //  the next token.
@@ -224,12 +429,38 @@ template <class Iterator, class Char, class Traits, class Allocator>
 void Lexer<Iterator, Char, Traits, Allocator>::advance()
 {
     LALR_ASSERT( state_machine_ );
-    skip();
-    lexeme_.clear();
-    line_ = position_.line();
-    column_ = position_.column();
-    full_ = position_.ended();
-    symbol_ = !position_.ended() ? run() : end_symbol_;
+    suspended_ = false;
+    do
+    {
+        if ( !run_state_ )
+        {
+            skip();
+            if ( skip_state_ || (position_.ended() && !final_) )
+            {
+                symbol_ = nullptr;
+                suspended_ = true;
+                return;
+            }
+
+            lexeme_.clear();
+            lexeme_begin_ = position_.position();
+            lexeme_tail_ = lexeme_begin_;
+            lexeme_end_ = lexeme_begin_;
+            lexeme_contiguous_ = true;
+            lexeme_materialized_ = true;
+            line_ = position_.line();
+            column_ = position_.column();
+            full_ = position_.ended();
+        }
+
+        symbol_ = run_state_ || !position_.ended() ? run() : end_symbol_;
+        if ( run_state_ )
+        {
+            suspended_ = true;
+            return;
+        }
+    }
+    while ( skip_symbol_ && symbol_ == skip_symbol_ );
 }
 
 /**
@@ -243,10 +474,11 @@ void Lexer<Iterator, Char, Traits, Allocator>::skip()
 
     if ( whitespace_state_machine_ )
     {
-        const LexerState* state = whitespace_state_machine_->start_state;
+        const LexerState* state = skip_state_ ? skip_state_ : whitespace_state_machine_->start_state;
         LALR_ASSERT( state );
+        skip_state_ = nullptr;
         const LexerTransition* transition = nullptr;
-        while ( !position_.ended() && (transition = find_transition_by_character(state, *position_)) )
+        while ( !position_.ended() && (transition = find_transition_by_character(whitespace_state_machine_, state, *position_)) )
         {
             state = transition->state;            
             if ( transition->action )
@@ -264,8 +496,17 @@ void Lexer<Iterator, Char, Traits, Allocator>::skip()
             else
             {
                 ++position_;
+                if ( state->loop )
+                {
+                    scan( state->loop );
+                }
             }
         }        
+
+        if ( position_.ended() && !final_ )
+        {
+            skip_state_ = state;
+        }
     }
 }
 
@@ -273,6 +514,12 @@ void Lexer<Iterator, Char, Traits, Allocator>::skip()
 // Run this %Lexer over its input using the state machine specified by 
 // \e data.
 //
+// Matched characters aren't copied into the lexeme as they are scanned; the
+// lexeme is copied from the input in one step when it is requested (see
+// Lexer::lexeme()).  The part of the lexeme matched before a lexer action
+// is copied before the action is called so that the action sees the 
+// partial lexeme in \e lexeme as it always has.
+//
 // @param state
 //  The start state of the state machine to use when running this %Lexer 
 //  for this call.
@@ -288,12 +535,13 @@ const void* Lexer<Iterator, Char, Traits, Allocator>::run()
     LALR_ASSERT( state_machine_->start_state );
     
     const void* symbol = nullptr;
-    const LexerState* state = state_machine_->start_state;
+    const LexerState* state = run_state_ ? run_state_ : state_machine_->start_state;
+    run_state_ = nullptr;
     if ( state )
     {
         symbol = state->symbol;
         const LexerTransition* transition = nullptr;
-        while ( !position_.ended() && (transition = find_transition_by_character(state, *position_)) )
+        while ( !position_.ended() && (transition = find_transition_by_character(state_machine_, state, *position_)) )
         {
             state = transition->state;
             symbol = state->symbol;
@@ -306,17 +554,47 @@ const void* Lexer<Iterator, Char, Traits, Allocator>::run()
                 LALR_ASSERT( function );
                 int lines = 0;
                 Iterator position = position_.position();
+                lexeme_.append( lexeme_tail_, position );
                 function( position_.position(), end_, &lexeme_, &symbol, &position, &lines );
                 position_.skip( position, lines );
+                lexeme_tail_ = position_.position();
+                lexeme_contiguous_ = false;
             }
             else
             {
-                lexeme_ += *position_;
                 ++position_;
+                if ( state->loop )
+                {
+                    scan( state->loop );
+                }
             }
         }
+        // The token may continue in the next part of streamed input so keep 
+        // the state and the part of the lexeme matched so far to resume 
+        // from rather than matching the token now.
+        if ( position_.ended() && !final_ )
+        {
+            run_state_ = state;
+            lexeme_.append( lexeme_tail_, position_.position() );
+            lexeme_tail_ = position_.position();
+            lexeme_end_ = lexeme_tail_;
+            lexeme_contiguous_ = false;
+            lexeme_materialized_ = true;
+            return nullptr;
+        }
+
+        lexeme_end_ = position_.position();
+        lexeme_materialized_ = false;
+        bool empty = lexeme_.empty() && lexeme_tail_ == lexeme_end_;
+
+        // Whitespace that matches nothing isn't a match at all otherwise
+        // folded whitespace that can be empty would match forever.
+        if ( symbol && symbol == skip_symbol_ && empty )
+        {
+            symbol = nullptr;
+        }
         
-        if ( !position_.ended() && !symbol && lexeme_.empty() )
+        if ( !position_.ended() && !symbol && empty )
         {
             error();
         }
@@ -325,6 +603,25 @@ const void* Lexer<Iterator, Char, Traits, Allocator>::run()
     return state ? symbol : NULL;
 }
 
+/**
+// Scan this %Lexer over the run of characters at its current position 
+// that transition the current state back to itself.
+//
+// This has the same effect as taking each of those transitions in turn 
+// but doesn't need to look up a transition for each character.
+//
+// @param loop
+//  The characters that the current state loops on (assumed not null).
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+void Lexer<Iterator, Char, Traits, Allocator>::scan( const LexerLoop* loop )
+{
+    LALR_ASSERT( loop );
+    typedef std::integral_constant<bool, std::is_convertible<Iterator, const Char*>::value && sizeof(Char) == 1> bytes;
+    Iterator position = scan( loop, position_.position(), end_, bytes() );
+    position_.advance( position, loops(loop, '\n') || loops(loop, '\r') );
+}
+
 /**
 // Recover this %Lexer after a lexical %error to make sure that it can recognize
 // the next character.
@@ -339,11 +636,11 @@ void Lexer<Iterator, Char, Traits, Allocator>::error()
     LALR_ASSERT( state_machine_->start_state );
     LALR_ASSERT( !position_.ended() );
 
-    fire_error( line_, column_, LEXER_ERROR_LEXICAL_ERROR, "Lexical error on character '%c' (%d)", int(*position_), int(*position_) );
+    fire_error( line(), column(), LEXER_ERROR_LEXICAL_ERROR, "Lexical error on character '%c' (%d)", int(*position_), int(*position_) );
     
     const LexerTransition* transition = NULL;
     const LexerState* state = state_machine_->start_state;
-    while ( !position_.ended() && !(transition = find_transition_by_character(state, *position_)) )
+    while ( !position_.ended() && !(transition = find_transition_by_character(state_machine_, state, *position_)) )
     {
         ++position_;
     }
@@ -379,10 +676,39 @@ void Lexer<Iterator, Char, Traits, Allocator>::fire_error( int line, int column,
     }    
 }
 
-
+/**
+// Find the transition from \e state on \e character.
+//
+// Characters in [0, 256) are looked up in the state machine's transition 
+// table when it has one otherwise the transitions from \e state are 
+// searched.
+//
+// @param state_machine
+//  The state machine that \e state is part of (assumed not null).
+//
+// @param state
+//  The state to find the transition from (assumed not null).
+//
+// @param character
+//  The character to find the transition on.
+//
+// @return
+//  The transition to take on \e character or null if there is no such 
+//  transition from \e state.
+*/
 template <class Iterator, class Char, class Traits, class Allocator>
-const LexerTransition* Lexer<Iterator, Char, Traits, Allocator>::find_transition_by_character( const LexerState* state, int character ) const
+const LexerTransition* Lexer<Iterator, Char, Traits, Allocator>::find_transition_by_character( const LexerStateMachine* state_machine, const LexerState* state, int character ) const
 {
+    LALR_ASSERT( state_machine );
+    LALR_ASSERT( state );
+
+    const int* transition_table = state_machine->transition_table;
+    if ( transition_table && character >= 0 && character < 256 )
+    {
+        int index = transition_table[state->index * state_machine->classes_size + state_machine->character_classes[character]];
+        return index != LexerTransition::INVALID_INDEX ? &state_machine->transitions[index] : nullptr;
+    }
+
     const LexerTransition* transition = state->transitions;
     const LexerTransition* transitions_end = state->transitions + state->length;
     while ( transition != transitions_end && !(character >= transition->begin && character < transition->end) )
@@ -392,6 +718,133 @@ const LexerTransition* Lexer<Iterator, Char, Traits, Allocator>::find_transition
     return transition != transitions_end ? transition : nullptr;
 }
 
+/**
+// Is \e character one of the characters in \e loop?
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+bool Lexer<Iterator, Char, Traits, Allocator>::loops( const LexerLoop* loop, int character )
+{
+    return character >= 0 && character < LexerLoop::CHARACTERS && (loop->characters[character / 8] & (1 << (character % 8))) != 0;
+}
+
+/**
+// Find the end of the run of characters in \e loop that starts at 
+// \e position in input that is a contiguous sequence of bytes.
+//
+// When SSE2 is available and the characters in \e loop fit in a few 
+// ranges sixteen characters are checked at a time by comparing each 
+// character against each range.  Signed characters with the high bit set 
+// are never in \e loop as they are negative when converted to int.  The 
+// remaining characters are checked one at a time.
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+Iterator Lexer<Iterator, Char, Traits, Allocator>::scan( const LexerLoop* loop, Iterator position, Iterator end, std::true_type /*bytes*/ )
+{
+    const Char* begin = position;
+    const Char* finish = end;
+    const Char* i = begin;
+
+#if LALR_LEXER_SIMD
+    const int BYTES = 16;
+    int ranges_size = loop->ranges_size;
+    if ( ranges_size > 0 )
+    {
+        __m128i firsts [LexerLoop::RANGES];
+        __m128i spans [LexerLoop::RANGES];
+        for ( int j = 0; j < ranges_size; ++j )
+        {
+            firsts[j] = _mm_set1_epi8( char(loop->ranges[j * 2]) );
+            spans[j] = _mm_set1_epi8( char(loop->ranges[j * 2 + 1] - loop->ranges[j * 2]) );
+        }
+
+        const __m128i zero = _mm_setzero_si128();
+        while ( finish - i >= BYTES )
+        {
+            __m128i characters = _mm_loadu_si128( reinterpret_cast<const __m128i*>(i) );
+            __m128i matches = zero;
+            for ( int j = 0; j < ranges_size; ++j )
+            {
+                __m128i offsets = _mm_sub_epi8( characters, firsts[j] );
+                matches = _mm_or_si128( matches, _mm_cmpeq_epi8(_mm_min_epu8(offsets, spans[j]), offsets) );
+            }
+            if ( std::is_signed<Char>::value )
+            {
+                matches = _mm_andnot_si128( _mm_cmplt_epi8(characters, zero), matches );
+            }
+
+            unsigned int mismatches = ~unsigned(_mm_movemask_epi8(matches)) & 0xffff;
+            if ( mismatches != 0 )
+            {
+                return position + ((i - begin) + count_trailing_zeros(mismatches));
+            }
+            i += BYTES;
+        }
+    }
+#endif
+
+    while ( i != finish && loops(loop, int(*i)) )
+    {
+        ++i;
+    }
+    return position + (i - begin);
+}
+
+/**
+// Find the end of the run of characters in \e loop that starts at 
+// \e position one character at a time.
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+Iterator Lexer<Iterator, Char, Traits, Allocator>::scan( const LexerLoop* loop, Iterator position, Iterator end, std::false_type /*bytes*/ )
+{
+    while ( position != end && loops(loop, int(*position)) )
+    {
+        ++position;
+    }
+    return position;
+}
+
+/**
+// Set [\e begin, \e end) to [\e lexeme_begin, \e lexeme_end) for input 
+// that is a contiguous sequence of characters.
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+bool Lexer<Iterator, Char, Traits, Allocator>::lexeme_range( const Iterator& lexeme_begin, const Iterator& lexeme_end, const Char** begin, const Char** end, std::true_type /*contiguous*/ )
+{
+    *begin = lexeme_begin;
+    *end = lexeme_end;
+    return true;
+}
+
+/**
+// Fail to provide a range for input that isn't a contiguous sequence of
+// characters.
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+bool Lexer<Iterator, Char, Traits, Allocator>::lexeme_range( const Iterator& /*lexeme_begin*/, const Iterator& /*lexeme_end*/, const Char** /*begin*/, const Char** /*end*/, std::false_type /*contiguous*/ )
+{
+    return false;
+}
+
+/**
+// Get the address of \e position in input that is a contiguous sequence 
+// of characters.
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+const Char* Lexer<Iterator, Char, Traits, Allocator>::address( const Iterator& position, std::true_type /*contiguous*/ )
+{
+    return position;
+}
+
+/**
+// Fail to provide an address for input that isn't a contiguous sequence 
+// of characters.
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+const Char* Lexer<Iterator, Char, Traits, Allocator>::address( const Iterator& /*position*/, std::false_type /*contiguous*/ )
+{
+    return nullptr;
+}
+
 }
 
 #endif
@@ -0,0 +1,26 @@
+#ifndef LALR_LEXERLOOP_HPP_INCLUDED
+#define LALR_LEXERLOOP_HPP_INCLUDED
+
+namespace lalr
+{
+
+/**
+// The characters that transition a state in a lexical analyzer's state
+// machine back to itself.
+//
+// Runs of these characters are consumed by the lexer without looking up
+// a transition for each character (see Lexer::scan()).
+*/
+class LexerLoop
+{
+public:
+    static const int CHARACTERS = 256;
+    static const int RANGES = 4;
+    unsigned char characters [CHARACTERS / 8]; ///< Bit set of the characters in [0, 256) that transition back to the state.
+    int ranges_size; ///< The number of ranges in ranges or 0 if the characters don't fit in RANGES ranges.
+    unsigned char ranges [RANGES * 2]; ///< The first and last character of each range of characters that transition back to the state.
+};
+
+}
+
+#endif
@@ -5,6 +5,7 @@ namespace lalr
 {
 
 class LexerTransition;
+class LexerLoop;
 
 /**
 // A state in a lexical analyzer's state machine.
@@ -16,6 +17,7 @@ public:
     int length; ///< Number of transitions from this state.
     const LexerTransition* transitions; ///< Transitions from this state.
     const void* symbol; ///< The symbol that this state recognizes or null if this state doesn't recognize a symbol.
+    const LexerLoop* loop; ///< The characters that transition this state back to itself or null if this state doesn't mostly loop on itself.
 };
 
 }
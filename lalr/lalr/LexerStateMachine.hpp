@@ -10,6 +10,7 @@ class LexerErrorPolicy;
 class LexerAction;
 class LexerTransition;
 class LexerState;
+class LexerLoop;
 
 /**
 // The data that defines the state machine for a lexical analyzer.
@@ -24,6 +25,12 @@ public:
     const LexerTransition* transitions;
     const LexerState* states;
     const LexerState* start_state;
+    int classes_size; ///< The number of character classes in the transition table.
+    const unsigned char* character_classes; ///< The class of each character in [0, 256) or null to search transitions instead.
+    const int* transition_table; ///< Transition indices addressed by state index and character class (-1 for no transition) or null to search transitions instead.
+    const void* skip_symbol; ///< The symbol matched by whitespace that is skipped by this state machine or null if whitespace is skipped by a separate state machine.
+    int loops_size; ///< The number of loops in loops.
+    const LexerLoop* loops; ///< The loops referenced by states that mostly loop on themselves.
 };
 
 }
@@ -13,6 +13,7 @@ class LexerAction;
 class LexerTransition
 {
 public:
+    static const int INVALID_INDEX = -1;
     int begin; ///< The first character that the transition can be made on.
     int end; ///< One past the last character that the transition can be made on.
     const LexerState* state; ///< The state that is transitioned to.
@@ -0,0 +1,173 @@
+//
+// MappedFile.cpp
+// Copyright (c) Charles Baker. All rights reserved.
+//
+
+#include "MappedFile.hpp"
+#include "assert.hpp"
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace lalr;
+
+static const char EMPTY[] = "";
+
+MappedFile::MappedFile()
+: begin_( EMPTY ),
+  end_( EMPTY ),
+  mapping_( nullptr )
+{
+}
+
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+/**
+// Map the file at \e path read-only into memory.
+//
+// Any file already mapped is unmapped first.  The mapping is advised to be
+// read sequentially.  Empty files map to an empty sequence without making
+// a mapping.
+//
+// @param path
+//  The path to the file to map (assumed not null).
+//
+// @return
+//  True if the file was mapped otherwise false.
+*/
+bool MappedFile::open( const char* path )
+{
+    LALR_ASSERT( path );
+    close();
+
+#if defined(_WIN32)
+    HANDLE file = CreateFileA( path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr );
+    if ( file == INVALID_HANDLE_VALUE )
+    {
+        return false;
+    }
+
+    LARGE_INTEGER size;
+    if ( !GetFileSizeEx(file, &size) )
+    {
+        CloseHandle( file );
+        return false;
+    }
+
+    if ( size.QuadPart > 0 )
+    {
+        HANDLE mapping = CreateFileMappingA( file, nullptr, PAGE_READONLY, 0, 0, nullptr );
+        const char* begin = mapping ? static_cast<const char*>( MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) ) : nullptr;
+        CloseHandle( file );
+        if ( !begin )
+        {
+            if ( mapping )
+            {
+                CloseHandle( mapping );
+            }
+            return false;
+        }
+        begin_ = begin;
+        end_ = begin + size_t(size.QuadPart);
+        mapping_ = mapping;
+    }
+    else
+    {
+        CloseHandle( file );
+    }
+#else
+    int file = ::open( path, O_RDONLY );
+    if ( file < 0 )
+    {
+        return false;
+    }
+
+    struct stat stat;
+    if ( ::fstat(file, &stat) != 0 )
+    {
+        ::close( file );
+        return false;
+    }
+
+    size_t size = size_t(stat.st_size);
+    if ( size > 0 )
+    {
+        void* begin = ::mmap( nullptr, size, PROT_READ, MAP_PRIVATE, file, 0 );
+        ::close( file );
+        if ( begin == MAP_FAILED )
+        {
+            return false;
+        }
+        ::madvise( begin, size, MADV_SEQUENTIAL );
+        begin_ = static_cast<const char*>( begin );
+        end_ = begin_ + size;
+    }
+    else
+    {
+        ::close( file );
+    }
+#endif
+
+    return true;
+}
+
+/**
+// Unmap the currently mapped file (if any).
+*/
+void MappedFile::close()
+{
+    if ( begin_ != EMPTY )
+    {
+#if defined(_WIN32)
+        UnmapViewOfFile( begin_ );
+        CloseHandle( mapping_ );
+#else
+        ::munmap( const_cast<char*>(begin_), size() );
+#endif
+    }
+    begin_ = EMPTY;
+    end_ = EMPTY;
+    mapping_ = nullptr;
+}
+
+/**
+// Get the first character of the mapped file.
+//
+// @return
+//  The first character of the mapped file or an empty string if no file 
+//  is mapped.
+*/
+const char* MappedFile::begin() const
+{
+    return begin_;
+}
+
+/**
+// Get one past the last character of the mapped file.
+//
+// @return
+//  One past the last character of the mapped file.
+*/
+const char* MappedFile::end() const
+{
+    return end_;
+}
+
+/**
+// Get the size of the mapped file.
+//
+// @return
+//  The number of characters in the mapped file.
+*/
+size_t MappedFile::size() const
+{
+    return size_t(end_ - begin_);
+}
@@ -0,0 +1,38 @@
+#ifndef LALR_MAPPEDFILE_HPP_INCLUDED
+#define LALR_MAPPEDFILE_HPP_INCLUDED
+
+#include <stddef.h>
+
+namespace lalr
+{
+
+/**
+// A file mapped read-only into memory as a contiguous sequence of 
+// characters.
+//
+// Parsers instantiated on `const char*` scan the mapping directly (see 
+// Parser::parse_file()) so that the file is never copied into memory.
+*/
+class MappedFile
+{
+    const char* begin_; ///< The first character in the mapping or an empty string if no file is mapped.
+    const char* end_; ///< One past the last character in the mapping.
+    void* mapping_; ///< The operating system handle to the mapping (if the operating system has one).
+
+public:
+    MappedFile();
+    ~MappedFile();
+    bool open( const char* path );
+    void close();
+    const char* begin() const;
+    const char* end() const;
+    size_t size() const;
+
+private:
+    MappedFile( const MappedFile& );
+    MappedFile& operator=( const MappedFile& );
+};
+
+}
+
+#endif
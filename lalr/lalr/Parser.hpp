@@ -6,7 +6,10 @@
 #include "AddParserActionHandler.hpp"
 #include "AddLexerActionHandler.hpp"
 #include "Lexer.hpp"
+#include "MappedFile.hpp"
 #include <vector>
+#include <memory>
+#include <cstdint>
 
 namespace error
 {
@@ -36,7 +39,8 @@ class Parser
         typedef lalr::ParserNode<Char, Traits, Allocator> ParserNode;
         typedef typename std::vector<ParserNode>::const_iterator ParserNodeConstIterator;
         typedef std::function<void (Iterator begin, Iterator end, std::basic_string<Char, Traits, Allocator>* lexeme, const void** symbol, Iterator* position, int* lines)> LexerActionFunction;
-        typedef std::function<UserData (const UserData* data, const ParserNode* nodes, size_t length)> ParserActionFunction;
+        typedef std::function<UserData (UserData* data, const ParserNode* nodes, size_t length)> ParserActionFunction;
+        typedef UserData (*ParserActionDispatch)( void* context, int action, UserData* data, const ParserNode* nodes, size_t length );
 
     private:
         struct ParserActionHandler
@@ -48,31 +52,47 @@ class Parser
 
         const ParserStateMachine* state_machine_; ///< The data that defines the state machine used by this parser.
         ErrorPolicy* error_policy_; ///< The error policy this parser uses to report errors and debug information.
-        std::vector<ParserNode> nodes_; ///< The stack of nodes that store symbols that are shifted and reduced during parsing.
-        std::vector<UserData> user_data_; ///< User data stack matching the stack of nodes.
+        std::vector<std::uint16_t> states_; ///< The stack of the indices of the states that symbols are shifted and reduced from.
+        std::vector<ParserNode> nodes_; ///< The symbols, lexemes, and positions matching the stack of states while nodes are enabled otherwise empty.
+        std::vector<UserData> user_data_; ///< The user data matching the stack of states while nodes are enabled otherwise only the user data returned by Parser::user_data().
         Lexer<Iterator, Char, Traits, Allocator> lexer_; ///< The lexical analyzer used during parsing.
+        std::shared_ptr<MappedFile> file_; ///< The file mapped by the most recent call to Parser::parse_file() (kept so that lexemes borrowed from it stay valid).
         std::vector<ParserActionHandler> action_handlers_; ///< The action handlers for parser actions taken during reduction.
         ParserActionFunction default_action_handler_; ///< The default action handler for reductions that don't specify any action.
+        ParserActionDispatch action_dispatch_; ///< The function that dispatches every parser action taken during reduction or null to use the action handlers.
+        void* action_dispatch_context_; ///< The context passed to action_dispatch_.
         bool debug_enabled_; ///< True if shift and reduce operations should be printed otherwise false.
+        bool nodes_enabled_; ///< True if nodes and user data are kept on the stack for action handlers or debugging otherwise false.
+        bool zero_copy_lexemes_enabled_; ///< True if lexemes should be borrowed from the input rather than copied where possible otherwise false.
+        const Char* token_position_; ///< The position in the input of the token being parsed when its line and column are resolved on demand otherwise null.
+        const ParserSymbol* reduced_symbol_; ///< The symbol being reduced to while a parser action handler is called otherwise null.
         bool accepted_; ///< True if the parser accepted its input otherwise false.
         bool full_; ///< True if the parser processed all of its input otherwise false.
+        bool feeding_; ///< True between the first call to Parser::feed() and the call to Parser::finish() that ends a streamed parse otherwise false.
+        bool parsing_; ///< True while a streamed parse is still accepting tokens otherwise false.
 
     public:
         Parser( const ParserStateMachine* state_machine, ErrorPolicy* error_policy = nullptr );
 
         void reset();
         void parse( Iterator start, Iterator finish );
+        void parse_file( const char* path );
+        void feed( Iterator start, Iterator finish );
+        void finish();
         bool parse( const void* symbol, const std::basic_string<Char, Traits, Allocator>& lexeme, int line, int column );
         bool parse( const ParserSymbol* symbol, const std::basic_string<Char, Traits, Allocator>& lexeme, int line, int column );
+        bool parse( const ParserSymbol* symbol, const Char* lexeme_begin, const Char* lexeme_end, int line, int column );
         bool accepted() const;
         bool full() const;
         const UserData& user_data() const;
+        const ParserSymbol* reduced_symbol() const;
         const Lexer<Iterator, Char, Traits, Allocator>& lexer() const;
 
         AddParserActionHandler<Iterator, UserData, Char, Traits, Allocator> parser_action_handlers();
         AddLexerActionHandler<Iterator, Char, Traits, Allocator> lexer_action_handlers();
         void set_default_action_handler( ParserActionFunction function );
         void set_action_handler( const char* identifier, ParserActionFunction function );
+        void set_action_dispatch( ParserActionDispatch dispatch, void* context );
         void set_lexer_action_handler( const char* identifier, LexerActionFunction function );
 
         void fire_error(int line, int column, int error, const char* format, ... ) const;
@@ -80,14 +100,27 @@ class Parser
         
         void set_debug_enabled( bool debug_enabled );
         bool is_debug_enabled() const;
+        void set_zero_copy_lexemes_enabled( bool zero_copy_lexemes_enabled );
+        bool is_zero_copy_lexemes_enabled() const;
+        void set_lazy_positions_enabled( bool lazy_positions_enabled );
+        bool is_lazy_positions_enabled() const;
         
     private:
+        bool parse_token();
+        void parse_tokens();
+        bool nodes_required() const;
+        void enable_nodes();
+        const ParserState* state() const;
+        const ParserTransition* reduce_until_shift( const ParserSymbol* symbol, bool* accepted, bool* rejected );
+        void reduce_by_default( bool* accepted, bool* rejected );
         const ParserTransition* find_transition( const ParserSymbol* symbol, const ParserState* state ) const;
-        typename std::vector<ParserNode>::iterator find_node_to_reduce_to( const ParserTransition* transition, std::vector<ParserNode>& nodes );
+        const ParserTransition* find_default_or_transition( const ParserSymbol* symbol, const ParserState* state ) const;
+        const ParserState* find_goto( const ParserSymbol* symbol, const ParserState* state ) const;
         void debug_shift( const ParserNode& node ) const;
         void debug_reduce( const ParserSymbol* reduced_symbol, std::ptrdiff_t start, std::ptrdiff_t finish ) const;
-        UserData handle( const ParserTransition* transition, std::ptrdiff_t start, std::ptrdiff_t finish ) const;
+        UserData handle( const ParserTransition* transition, std::ptrdiff_t start, std::ptrdiff_t finish );
         void shift( const ParserTransition* transition, const std::basic_string<Char, Traits, Allocator>& lexeme, int line, int column );
+        void shift( const ParserTransition* transition, const Char* lexeme_begin, const Char* lexeme_end, int line, int column );
         void reduce( const ParserTransition* transition, bool* accepted, bool* rejected );
         void error( bool* accepted, bool* rejected, int line, int column );
 };
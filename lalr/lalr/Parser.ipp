@@ -12,6 +12,7 @@
 #include "ParserAction.hpp"
 #include "ParserSymbol.hpp"
 #include "ParserStateMachine.hpp"
+#include "ParserLookup.hpp"
 #include "ErrorCode.hpp"
 #include "ParserNode.ipp"
 #include "ParserUserData.ipp"
@@ -23,6 +24,7 @@
 #include <stdarg.h>
 #include <stdio.h>
 #include <string.h>
+#include <utility>
 
 namespace lalr
 {
@@ -62,16 +64,27 @@ template <class Iterator, class UserData, class Char, class Traits, class Alloca
 Parser<Iterator, UserData, Char, Traits, Allocator>::Parser( const ParserStateMachine* state_machine, ErrorPolicy* error_policy )
 : state_machine_( state_machine ),
   error_policy_( error_policy ),
+  states_(),
   nodes_(),
   user_data_(),
   lexer_( state_machine_->lexer_state_machine, state_machine_->whitespace_lexer_state_machine, state_machine_->end_symbol, error_policy ),
+  file_(),
   action_handlers_(),
   default_action_handler_( NULL ),
+  action_dispatch_( nullptr ),
+  action_dispatch_context_( nullptr ),
   debug_enabled_( false ),
+  nodes_enabled_( false ),
+  zero_copy_lexemes_enabled_( false ),
+  token_position_( nullptr ),
+  reduced_symbol_( nullptr ),
   accepted_( false ),
-  full_( false )
+  full_( false ),
+  feeding_( false ),
+  parsing_( false )
 {
     LALR_ASSERT( state_machine_ );
+    LALR_ASSERT( state_machine_->states_size <= ParserStateMachine::MAXIMUM_STATES );
     
     action_handlers_.reserve( state_machine_->actions_size );
     const ParserAction* action = state_machine_->actions;
@@ -82,10 +95,10 @@ Parser<Iterator, UserData, Char, Traits, Allocator>::Parser( const ParserStateMa
         ++action;
     }
 
+    states_.reserve( 64 );
     nodes_.reserve( 64 );       
     user_data_.reserve( 64 );       
-    nodes_.push_back( ParserNode(state_machine_->start_state, nullptr, 0, 1) );
-    user_data_.push_back( UserData() );
+    reset();
 }
 
 /**
@@ -96,10 +109,19 @@ void Parser<Iterator, UserData, Char, Traits, Allocator>::reset()
 {
     accepted_ = false;
     full_ = false;
+    feeding_ = false;
+    parsing_ = false;
+    reduced_symbol_ = nullptr;
+    nodes_enabled_ = nodes_required();
+    states_.clear();
     nodes_.clear();
     user_data_.clear();
-    nodes_.push_back( ParserNode(state_machine_->start_state, nullptr, 0, 1) );
-    user_data_.push_back( UserData() );
+    states_.push_back( std::uint16_t(state_machine_->start_state->index) );
+    if ( nodes_enabled_ )
+    {
+        nodes_.emplace_back( state_machine_->start_state, nullptr, 0, 1 );
+    }
+    user_data_.emplace_back();
 }
 
 /**
@@ -126,16 +148,103 @@ void Parser<Iterator, UserData, Char, Traits, Allocator>::parse( Iterator start,
     reset();
     lexer_.reset( start, finish );    
     lexer_.advance();
-    const ParserSymbol* symbol = reinterpret_cast<const ParserSymbol*>( lexer_.symbol() );
-    while ( parse(symbol, lexer_.lexeme(), lexer_.line(), lexer_.column()) )
+    while ( parse_token() )
     {
         lexer_.advance();
-        symbol = reinterpret_cast<const ParserSymbol*>( lexer_.symbol() );
     }
 
     full_ = lexer_.full();
 }
 
+/**
+// Parse the file at \e path.
+//
+// The file is mapped read-only into memory and parsed in place rather than
+// being read into a buffer first.  This is only available for parsers on
+// `const char*` input.  The mapping is kept until the next call to 
+// Parser::parse_file() or until this Parser is destroyed so that lexemes 
+// borrowed from it when zero copy lexemes are enabled remain valid.
+//
+// A PARSER_ERROR_OPENING_FILE_FAILED error is reported and the parse isn't
+// accepted if the file can't be mapped.
+//
+// @param path
+//  The path to the file to parse (assumed not null).
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator>
+void Parser<Iterator, UserData, Char, Traits, Allocator>::parse_file( const char* path )
+{
+    LALR_ASSERT( path );
+
+    std::shared_ptr<MappedFile> file = std::make_shared<MappedFile>();
+    if ( !file->open(path) )
+    {
+        reset();
+        file_.reset();
+        fire_error( 0, 0, PARSER_ERROR_OPENING_FILE_FAILED, "Opening '%s' failed", path );
+        return;
+    }
+
+    file_ = file;
+    parse( file_->begin(), file_->end() );
+}
+
+/**
+// Parse the next part of streamed input.
+//
+// The first call after construction, Parser::reset(), or Parser::finish() 
+// starts a new parse.  Tokens are parsed as soon as they are known to be 
+// complete; a token that runs to the end of [\e start, \e finish) may 
+// continue in the next part of the input and so is held in the lexer 
+// until the next call to Parser::feed() or Parser::finish().  The input 
+// needn't remain valid after this call returns as lexemes that span parts
+// of the input are copied.
+//
+// @param start
+//  The first character in the next part of the input.
+//
+// @param finish
+//  One past the last character in the next part of the input.
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator>
+void Parser<Iterator, UserData, Char, Traits, Allocator>::feed( Iterator start, Iterator finish )
+{
+    LALR_ASSERT( state_machine_ );
+
+    if ( !feeding_ )
+    {
+        reset();
+        lexer_.reset( start, finish, false );
+        feeding_ = true;
+        parsing_ = true;
+    }
+    else
+    {
+        lexer_.feed( start, finish );
+    }
+    parse_tokens();
+}
+
+/**
+// Finish parsing streamed input passed to Parser::feed().
+//
+// After this call the Parser::full() and Parser::accepted() functions can
+// be used to determine whether or not the parse was successful as they 
+// are after Parser::parse().
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator>
+void Parser<Iterator, UserData, Char, Traits, Allocator>::finish()
+{
+    if ( !feeding_ )
+    {
+        feed( Iterator(), Iterator() );
+    }
+    lexer_.finish();
+    parse_tokens();
+    full_ = lexer_.full();
+    feeding_ = false;
+}
+
 /**
 // Continue a parse by accepting \e symbol as the next token.
 //
@@ -161,6 +270,9 @@ bool Parser<Iterator, UserData, Char, Traits, Allocator>::parse( const void* sym
 /**
 // Continue a parse by accepting \e symbol as the next token.
 //
+// Any default reductions available after \e symbol has been shifted are
+// made immediately rather than waiting for the next token.
+//
 // @param symbol
 //  The next token from the lexical analyzer in the current parse.
 //
@@ -179,16 +291,54 @@ bool Parser<Iterator, UserData, Char, Traits, Allocator>::parse( const ParserSym
     bool accepted = false;
     bool rejected = false;
     
-    const ParserTransition* transition = find_transition( symbol, nodes_.back().state() );
-    while ( !accepted && !rejected && transition && transition->type == TRANSITION_REDUCE )
+    const ParserTransition* transition = reduce_until_shift( symbol, &accepted, &rejected );
+    if ( transition )
     {
-        reduce( transition, &accepted, &rejected );
-        transition = find_transition( symbol, nodes_.back().state() );
+        shift( transition, lexeme, line, column );
+        reduce_by_default( &accepted, &rejected );
+    }
+    else
+    {
+        error( &accepted, &rejected, line, column);
     }
     
-    if ( transition && transition->type == TRANSITION_SHIFT )
+    accepted_ = accepted;
+    return !accepted_ && !rejected;
+}
+
+/**
+// Continue a parse by accepting \e symbol as the next token borrowing its
+// lexeme from the input.
+//
+// The lexeme isn't copied and so [\e lexeme_begin, \e lexeme_end) must 
+// remain valid for as long as the ParserNodes that refer to it are in use.
+//
+// @param symbol
+//  The next token from the lexical analyzer in the current parse.
+//
+// @param lexeme_begin
+//  The first character of the lexeme of the next token.
+//
+// @param lexeme_end
+//  One past the last character of the lexeme of the next token.
+//
+// @param line
+//  The line number at the start of the next token.
+//
+// @return
+//  True until parsing is complete or an error occurs.
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator>
+bool Parser<Iterator, UserData, Char, Traits, Allocator>::parse( const ParserSymbol* symbol, const Char* lexeme_begin, const Char* lexeme_end, int line, int column )
+{
+    bool accepted = false;
+    bool rejected = false;
+    
+    const ParserTransition* transition = reduce_until_shift( symbol, &accepted, &rejected );
+    if ( transition )
     {
-        shift( transition, lexeme, line, column );
+        shift( transition, lexeme_begin, lexeme_end, line, column );
+        reduce_by_default( &accepted, &rejected );
     }
     else
     {
@@ -199,6 +349,123 @@ bool Parser<Iterator, UserData, Char, Traits, Allocator>::parse( const ParserSym
     return !accepted_ && !rejected;
 }
 
+/**
+// Continue a parse by accepting the token most recently matched by the
+// lexer.
+//
+// The token's lexeme is borrowed from the input when zero copy lexemes are
+// enabled and the lexer is able to provide the lexeme as a range of the 
+// input otherwise it is copied.
+//
+// @return
+//  True until parsing is complete or an error occurs.
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator>
+bool Parser<Iterator, UserData, Char, Traits, Allocator>::parse_token()
+{
+    const ParserSymbol* symbol = reinterpret_cast<const ParserSymbol*>( lexer_.symbol() );
+    int line = 0;
+    int column = 1;
+    token_position_ = lexer_.positions() ? lexer_.lexeme_position() : nullptr;
+    if ( !token_position_ )
+    {
+        line = lexer_.line();
+        column = lexer_.column();
+    }
+
+    bool parsing = false;
+    const Char* lexeme_begin = nullptr;
+    const Char* lexeme_end = nullptr;
+    if ( !nodes_enabled_ || (zero_copy_lexemes_enabled_ && lexer_.lexeme_range(&lexeme_begin, &lexeme_end)) )
+    {
+        parsing = parse( symbol, lexeme_begin, lexeme_end, line, column );
+    }
+    else
+    {
+        parsing = parse( symbol, lexer_.lexeme(), line, column );
+    }
+    token_position_ = nullptr;
+    return parsing;
+}
+
+/**
+// Parse tokens from streamed input until the lexer runs out of input or 
+// parsing is complete.
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator>
+void Parser<Iterator, UserData, Char, Traits, Allocator>::parse_tokens()
+{
+    if ( parsing_ )
+    {
+        lexer_.advance();
+        while ( !lexer_.suspended() && (parsing_ = parse_token()) )
+        {
+            lexer_.advance();
+        }
+    }
+}
+
+/**
+// Are nodes and user data needed on the stack?
+//
+// Nodes and user data are only needed when there are action handlers to 
+// pass them to or when shifts and reductions are printed for debugging.
+//
+// @return
+//  True if nodes and user data are needed otherwise false.
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator>
+bool Parser<Iterator, UserData, Char, Traits, Allocator>::nodes_required() const
+{
+    if ( debug_enabled_ || default_action_handler_ || action_dispatch_ )
+    {
+        return true;
+    }
+    for ( typename std::vector<ParserActionHandler>::const_iterator i = action_handlers_.begin(); i != action_handlers_.end(); ++i )
+    {
+        if ( i->function_ )
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+// Start keeping nodes and user data on the stack.
+//
+// Nodes are added for any states already on the stack so that a handler or
+// debugging enabled part way through a parse sees a consistent stack.
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator>
+void Parser<Iterator, UserData, Char, Traits, Allocator>::enable_nodes()
+{
+    if ( !nodes_enabled_ )
+    {
+        nodes_enabled_ = true;
+        nodes_.clear();
+        user_data_.clear();
+        for ( typename std::vector<std::uint16_t>::const_iterator i = states_.begin(); i != states_.end(); ++i )
+        {
+            nodes_.emplace_back( &state_machine_->states[*i], nullptr, 0, 1 );
+            user_data_.emplace_back();
+        }
+    }
+}
+
+/**
+// Get the state on the top of the stack.
+//
+// @return
+//  The state.
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator>
+const ParserState* Parser<Iterator, UserData, Char, Traits, Allocator>::state() const
+{
+    LALR_ASSERT( !states_.empty() );
+    return &state_machine_->states[states_.back()];
+}
+
 /**
 // Did the most recent parse accept input successfully?
 //
@@ -236,11 +503,27 @@ template <class Iterator, class UserData, class Char, class Traits, class Alloca
 const UserData& Parser<Iterator, UserData, Char, Traits, Allocator>::user_data() const
 {
     LALR_ASSERT( accepted() );
-    LALR_ASSERT( nodes_.size() == 1 );
+    LALR_ASSERT( states_.size() == 1 );
     LALR_ASSERT( user_data_.size() == 1 );
     return user_data_.front();
 }
 
+/**
+// Get the symbol that is being reduced to.
+//
+// Only valid while a parser action handler is being called; this is how
+// handlers that are shared between productions, e.g. the default action
+// handler, find out which symbol they are reducing to.
+//
+// @return
+//  The symbol being reduced to or null if no reduction is in progress.
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator>
+const ParserSymbol* Parser<Iterator, UserData, Char, Traits, Allocator>::reduced_symbol() const
+{
+    return reduced_symbol_;
+}
+
 
 /**
 // Get the Lexer that is being used by this Parser.
@@ -291,6 +574,10 @@ template <class Iterator, class UserData, class Char, class Traits, class Alloca
 void Parser<Iterator, UserData, Char, Traits, Allocator>::set_default_action_handler( ParserActionFunction function )
 {
     default_action_handler_ = function;
+    if ( function )
+    {
+        enable_nodes();
+    }
 }
 
 /**
@@ -317,6 +604,37 @@ void Parser<Iterator, UserData, Char, Traits, Allocator>::set_action_handler( co
     if ( action_handler != action_handlers_.end() )
     {
         action_handler->function_ = function;
+        if ( function )
+        {
+            enable_nodes();
+        }
+    }
+}
+
+/**
+// Set the function that dispatches every parser action to \e dispatch.
+//
+// The dispatch function is called with the index of the action being taken
+// in place of looking up an action handler by index; it is usually a 
+// `switch` generated by lalrc that calls a handler class's member functions
+// directly (see StaticParser).  Reductions without an action still go to 
+// the default action handler.
+//
+// @param dispatch
+//  The function to dispatch parser actions to or null to return to using 
+//  the action handlers.
+//
+// @param context
+//  The context to pass to \e dispatch, e.g. the handler object.
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator>
+void Parser<Iterator, UserData, Char, Traits, Allocator>::set_action_dispatch( ParserActionDispatch dispatch, void* context )
+{
+    action_dispatch_ = dispatch;
+    action_dispatch_context_ = context;
+    if ( dispatch )
+    {
+        enable_nodes();
     }
 }
 
@@ -399,6 +717,10 @@ template <class Iterator, class UserData, class Char, class Traits, class Alloca
 void Parser<Iterator, UserData, Char, Traits, Allocator>::set_debug_enabled( bool debug_enabled )
 {
     debug_enabled_ = debug_enabled;
+    if ( debug_enabled_ )
+    {
+        enable_nodes();
+    }
 }
 
 /**
@@ -413,9 +735,129 @@ bool Parser<Iterator, UserData, Char, Traits, Allocator>::is_debug_enabled() con
     return debug_enabled_;
 }
 
+/**
+// Set whether or not lexemes are borrowed from the input rather than 
+// copied.
+//
+// Borrowed lexemes are only used when the input is a contiguous sequence 
+// of characters (Iterator converts to const Char*) and then only for tokens
+// whose lexemes haven't been rewritten by a lexer action.  The input must
+// remain valid for as long as the ParserNodes passed to action handlers 
+// are in use.
+//
+// @param zero_copy_lexemes_enabled
+//  True to borrow lexemes from the input where possible or false to always
+//  copy lexemes.
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator>
+void Parser<Iterator, UserData, Char, Traits, Allocator>::set_zero_copy_lexemes_enabled( bool zero_copy_lexemes_enabled )
+{
+    zero_copy_lexemes_enabled_ = zero_copy_lexemes_enabled;
+}
+
+/**
+// Are lexemes borrowed from the input rather than copied?
+//
+// @return
+//  True if lexemes are borrowed from the input where possible otherwise 
+//  false.
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator>
+bool Parser<Iterator, UserData, Char, Traits, Allocator>::is_zero_copy_lexemes_enabled() const
+{
+    return zero_copy_lexemes_enabled_;
+}
+
+/**
+// Enable or disable resolving line and column numbers on demand.
+//
+// When enabled and the input is a contiguous sequence of characters the 
+// lexer doesn't count lines and columns as it scans.  Each node records 
+// its position in the input instead and resolves it to a line and column
+// number only when ParserNode::line() or ParserNode::column() is called 
+// or an error is reported.
+//
+// @param lazy_positions_enabled
+//  True to resolve line and column numbers on demand or false to count 
+//  them while scanning.
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator>
+void Parser<Iterator, UserData, Char, Traits, Allocator>::set_lazy_positions_enabled( bool lazy_positions_enabled )
+{
+    lexer_.set_lazy_positions_enabled( lazy_positions_enabled );
+}
+
+/**
+// Are line and column numbers resolved on demand?
+//
+// @return
+//  True if line and column numbers are resolved on demand for contiguous
+//  input otherwise false.
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator>
+bool Parser<Iterator, UserData, Char, Traits, Allocator>::is_lazy_positions_enabled() const
+{
+    return lexer_.is_lazy_positions_enabled();
+}
+
+/**
+// Make any reductions on \e symbol needed before it can be shifted.
+//
+// @param symbol
+//  The symbol that is about to be shifted.
+//
+// @param accepted
+//  A variable to receive whether or not this Parser is still accepting input.
+//
+// @param rejected
+//  A variable to receive whether or not this Parser has rejected its input.
+//
+// @return
+//  The transition that shifts \e symbol or null if \e symbol can't be 
+//  shifted (because the input has been accepted, rejected, or is in error).
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator>
+const ParserTransition* Parser<Iterator, UserData, Char, Traits, Allocator>::reduce_until_shift( const ParserSymbol* symbol, bool* accepted, bool* rejected )
+{
+    LALR_ASSERT( accepted );
+    LALR_ASSERT( rejected );
+    const ParserTransition* transition = find_default_or_transition( symbol, state() );
+    while ( !*accepted && !*rejected && transition && transition->type == TRANSITION_REDUCE )
+    {
+        reduce( transition, accepted, rejected );
+        transition = find_default_or_transition( symbol, state() );
+    }
+    return transition && transition->type == TRANSITION_SHIFT ? transition : nullptr;
+}
+
+/**
+// Make default reductions from the state on the top of the stack until a
+// state that must examine the next token is reached.
+//
+// @param accepted
+//  A variable to receive whether or not this Parser is still accepting input.
+//
+// @param rejected
+//  A variable to receive whether or not this Parser has rejected its input.
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator>
+void Parser<Iterator, UserData, Char, Traits, Allocator>::reduce_by_default( bool* accepted, bool* rejected )
+{
+    LALR_ASSERT( accepted );
+    LALR_ASSERT( rejected );
+    const ParserTransition* transition = state()->default_transition;
+    while ( !*accepted && !*rejected && transition )
+    {
+        reduce( transition, accepted, rejected );
+        transition = state()->default_transition;
+    }
+}
+
 /**
 // Find the Transition for \e symbol in \e state.
 //
+// See find_parser_transition().
+//
 // @param symbol
 //  The symbol to find the transition for.
 //
@@ -429,39 +871,48 @@ bool Parser<Iterator, UserData, Char, Traits, Allocator>::is_debug_enabled() con
 template <class Iterator, class UserData, class Char, class Traits, class Allocator>
 const ParserTransition* Parser<Iterator, UserData, Char, Traits, Allocator>::find_transition( const ParserSymbol* symbol, const ParserState* state ) const
 {
-    LALR_ASSERT( state );
-    LALR_ASSERT( state_machine_ );
-    const ParserTransition* transition = state->transitions;
-    const ParserTransition* transitions_end = state->transitions + state->length;
-    while ( transition != transitions_end && transition->symbol != symbol )
-    {
-        ++transition;
-    }
-    return transition != transitions_end ? transition : nullptr;
+    return find_parser_transition( state_machine_, symbol, state );
 }
 
 /**
-// @internal
+// Find the default reduction from \e state or, if there isn't one, the
+// Transition for \e symbol in \e state.
 //
-// Find the Node to reduce to when \e production is reduced.
+// @param symbol
+//  The symbol to find the transition for when \e state has no default
+//  reduction.
 //
-// @param transition
-//  The reducing transition.
+// @param state
+//  The state to find the transition from (assumed not null).
 //
-// @param nodes
-//  The ParserNodes currently on the stack.
+// @return
+//  The default reduction from \e state, the transition to take on 
+//  \e symbol, or null if there was no such transition from \e state.
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator>
+const ParserTransition* Parser<Iterator, UserData, Char, Traits, Allocator>::find_default_or_transition( const ParserSymbol* symbol, const ParserState* state ) const
+{
+    LALR_ASSERT( state );
+    return state->default_transition ? state->default_transition : find_transition( symbol, state );
+}
+
+/**
+// Find the state transitioned to after reducing to \e symbol in \e state.
+//
+// @param symbol
+//  The non-terminal symbol that has just been reduced to (assumed not null).
+//
+// @param state
+//  The state uncovered on the stack by the reduction (assumed not null).
 //
 // @return
-//  The iterator to the Node to reduce to or the end iterator for \e nodes
-//  if no Node to reduce to could be found.
+//  The state to transition to or null if there is no such transition from
+//  \e state.
 */
 template <class Iterator, class UserData, class Char, class Traits, class Allocator>
-typename std::vector<ParserNode<Char, Traits, Allocator> >::iterator Parser<Iterator, UserData, Char, Traits, Allocator>::find_node_to_reduce_to( const ParserTransition* transition, std::vector<ParserNode>& nodes )
+const ParserState* Parser<Iterator, UserData, Char, Traits, Allocator>::find_goto( const ParserSymbol* symbol, const ParserState* state ) const
 {
-    LALR_ASSERT( transition );
-    LALR_ASSERT( transition->reduced_length < int(nodes.size()) );
-    typename std::vector<ParserNode>::reverse_iterator node = nodes.rbegin() + transition->reduced_length;
-    return node != nodes.rend() ? node.base() : nodes_.begin();
+    return find_parser_goto( state_machine_, symbol, state );
 }
 
 /**
@@ -546,9 +997,13 @@ void Parser<Iterator, UserData, Char, Traits, Allocator>::debug_reduce( const Pa
 //
 // @return
 //  The user data that results from the reduction.
+//
+// The user data of the symbols being reduced is passed to the handler as 
+// a mutable range that is discarded once the handler returns so that the
+// handler may move from it rather than copy it.
 */
 template <class Iterator, class UserData, class Char, class Traits, class Allocator>
-UserData Parser<Iterator, UserData, Char, Traits, Allocator>::handle( const ParserTransition* transition, std::ptrdiff_t start, std::ptrdiff_t finish ) const
+UserData Parser<Iterator, UserData, Char, Traits, Allocator>::handle( const ParserTransition* transition, std::ptrdiff_t start, std::ptrdiff_t finish )
 {
     LALR_ASSERT( start >= 0 && size_t(start) <= nodes_.size() );
     LALR_ASSERT( start >= 0 && size_t(start) <= user_data_.size() );
@@ -557,7 +1012,7 @@ UserData Parser<Iterator, UserData, Char, Traits, Allocator>::handle( const Pars
     LALR_ASSERT( start <= finish );
     LALR_ASSERT( transition );
 
-    const UserData* user_data = size_t(start) < user_data_.size() ? &user_data_[start] : nullptr;
+    UserData* user_data = size_t(start) < user_data_.size() ? &user_data_[start] : nullptr;
     const ParserNode* nodes = size_t(start) < nodes_.size() ? &nodes_[start] : nullptr;
     size_t length = finish - start;
 
@@ -565,6 +1020,10 @@ UserData Parser<Iterator, UserData, Char, Traits, Allocator>::handle( const Pars
     if ( action != ParserAction::INVALID_INDEX )
     {
         LALR_ASSERT( action >= 0 && action < static_cast<int>(action_handlers_.size()) );            
+        if ( action_dispatch_ )
+        {
+            return action_dispatch_( action_dispatch_context_, action, user_data, nodes, length );
+        }
         if ( action_handlers_[action].function_ )
         {
             return action_handlers_[action].function_( user_data, nodes, length );
@@ -601,10 +1060,57 @@ void Parser<Iterator, UserData, Char, Traits, Allocator>::shift( const ParserTra
     LALR_ASSERT( transition );
     LALR_ASSERT( line >= 0 );
     LALR_ASSERT( column >= 1 );
-    ParserNode node( transition->state, transition->symbol, lexeme, line, column );
-    debug_shift( node );
-    nodes_.push_back( node );
-    user_data_.push_back( UserData() );
+    states_.push_back( std::uint16_t(transition->state->index) );
+    if ( nodes_enabled_ )
+    {
+        nodes_.emplace_back( transition->state, transition->symbol, lexeme, line, column );
+        if ( token_position_ )
+        {
+            nodes_.back().set_position( lexer_.positions(), token_position_ );
+        }
+        debug_shift( nodes_.back() );
+        user_data_.emplace_back();
+    }
+}
+
+/**
+// Shift the current token onto the stack borrowing its lexeme from the 
+// input.
+//
+// @param transition
+//  The shift transition that specifies the state that will be transitioned
+//  into after the shift.
+//
+// @param lexeme_begin
+//  The first character of the lexeme of the token that is being shifted 
+//  onto the stack.
+//
+// @param lexeme_end
+//  One past the last character of the lexeme of the token that is being
+//  shifted onto the stack.
+//
+// @param line
+//  The line number at the start of the token that is being shifted onto the 
+//  stack (assumed >= 0).
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator>
+void Parser<Iterator, UserData, Char, Traits, Allocator>::shift( const ParserTransition* transition, const Char* lexeme_begin, const Char* lexeme_end, int line, int column )
+{
+    LALR_ASSERT( state_machine_ );
+    LALR_ASSERT( transition );
+    LALR_ASSERT( line >= 0 );
+    LALR_ASSERT( column >= 1 );
+    states_.push_back( std::uint16_t(transition->state->index) );
+    if ( nodes_enabled_ )
+    {
+        nodes_.emplace_back( transition->state, transition->symbol, lexeme_begin, lexeme_end, line, column );
+        if ( token_position_ )
+        {
+            nodes_.back().set_position( lexer_.positions(), token_position_ );
+        }
+        debug_shift( nodes_.back() );
+        user_data_.emplace_back();
+    }
 }
 
 /**
@@ -629,28 +1135,43 @@ void Parser<Iterator, UserData, Char, Traits, Allocator>::reduce( const ParserTr
     const ParserSymbol* symbol = transition->reduced_symbol;
     if ( symbol != state_machine_->start_symbol )
     {
-        typename std::vector<ParserNode>::iterator i = find_node_to_reduce_to( transition, nodes_ );
-        std::ptrdiff_t start = i - nodes_.begin();
-        std::ptrdiff_t finish = nodes_.end() - nodes_.begin();
-
-        debug_reduce( transition->reduced_symbol, start, finish );
-        int line = i != nodes_.end() ? nodes_[start].line() : 0;
-        int column = i != nodes_.end() ? nodes_[start].column() : 1;
-        UserData user_data = handle( transition, start, finish );
-        nodes_.erase( nodes_.begin() + start, nodes_.end() );
-        user_data_.erase( user_data_.begin() + start, user_data_.end() );
-        const ParserTransition* transition = find_transition( symbol, nodes_.back().state() );
-        LALR_ASSERT( transition );
-        ParserNode node( transition->state, symbol, line, column );
-        nodes_.push_back( node );
-        user_data_.push_back( user_data );
+        LALR_ASSERT( transition->reduced_length >= 0 && size_t(transition->reduced_length) < states_.size() );
+        std::ptrdiff_t start = std::ptrdiff_t(states_.size()) - transition->reduced_length;
+        std::ptrdiff_t finish = std::ptrdiff_t(states_.size());
+        const ParserState* state = find_goto( symbol, &state_machine_->states[states_[start - 1]] );
+        LALR_ASSERT( state );
+
+        if ( nodes_enabled_ )
+        {
+            debug_reduce( symbol, start, finish );
+            ParserNode node( state, symbol, 0, 1 );
+            if ( start < finish )
+            {
+                node.set_position( nodes_[start] );
+            }
+            reduced_symbol_ = symbol;
+            UserData user_data = handle( transition, start, finish );
+            reduced_symbol_ = nullptr;
+            nodes_.erase( nodes_.begin() + start, nodes_.end() );
+            user_data_.erase( user_data_.begin() + start, user_data_.end() );
+            nodes_.push_back( std::move(node) );
+            user_data_.push_back( std::move(user_data) );
+        }
+
+        states_.resize( size_t(start) );
+        states_.push_back( std::uint16_t(state->index) );
     }
     else
     {    
-        LALR_ASSERT( nodes_.size() == 2 );
-        LALR_ASSERT( user_data_.size() == 2 );
-        nodes_.erase( nodes_.begin() );
-        user_data_.erase( user_data_.begin() );
+        LALR_ASSERT( states_.size() == 2 );
+        states_.erase( states_.begin() );
+        if ( nodes_enabled_ )
+        {
+            LALR_ASSERT( nodes_.size() == 2 );
+            LALR_ASSERT( user_data_.size() == 2 );
+            nodes_.erase( nodes_.begin() );
+            user_data_.erase( user_data_.begin() );
+        }
         *accepted = true;
     }              
 }
@@ -672,15 +1193,19 @@ template <class Iterator, class UserData, class Char, class Traits, class Alloca
 void Parser<Iterator, UserData, Char, Traits, Allocator>::error( bool* accepted, bool* rejected, int line, int column )
 {
     LALR_ASSERT( state_machine_ );
-    LALR_ASSERT( !nodes_.empty() );
-    LALR_ASSERT( !user_data_.empty() );
+    LALR_ASSERT( !states_.empty() );
     LALR_ASSERT( accepted );
     LALR_ASSERT( rejected );
 
+    if ( token_position_ )
+    {
+        lexer_.positions()->resolve( token_position_, &line, &column );
+    }
+
     bool handled = false;
-    while ( !nodes_.empty() && !handled && !*accepted && !*rejected )
+    while ( !states_.empty() && !handled && !*accepted && !*rejected )
     {
-        const ParserTransition* transition = find_transition( state_machine_->error_symbol, nodes_.back().state() );
+        const ParserTransition* transition = find_transition( state_machine_->error_symbol, state() );
         if ( transition )
         {
             switch ( transition->type )
@@ -703,12 +1228,16 @@ void Parser<Iterator, UserData, Char, Traits, Allocator>::error( bool* accepted,
         }
         else
         {
-            nodes_.pop_back();
-            user_data_.pop_back();
+            states_.pop_back();
+            if ( nodes_enabled_ )
+            {
+                nodes_.pop_back();
+                user_data_.pop_back();
+            }
         }
     }
     
-    if ( nodes_.empty() )
+    if ( states_.empty() )
     {
         fire_error( line, column, PARSER_ERROR_SYNTAX, "Syntax error" );
         *rejected = true;
@@ -0,0 +1,116 @@
+#ifndef LALR_PARSERLOOKUP_HPP_INCLUDED
+#define LALR_PARSERLOOKUP_HPP_INCLUDED
+
+#include "ParserStateMachine.hpp"
+#include "ParserState.hpp"
+#include "ParserSymbol.hpp"
+#include "ParserTransition.hpp"
+#include "assert.hpp"
+
+namespace lalr
+{
+
+/**
+// Find the transition on \e symbol from \e state in \e state_machine.
+//
+// Looks the transition up in the state machine's action table when it has
+// one, then in its compressed tables when it has those, and otherwise 
+// searches the transitions from \e state.
+//
+// The compressed tables return the default reduction for \e state when 
+// there is no explicit transition on a terminal \e symbol so input that 
+// is in error may be reduced before the error is detected (as in yacc).
+//
+// @param state_machine
+//  The state machine to find the transition in (assumed not null).
+//
+// @param symbol
+//  The symbol to find the transition for.
+//
+// @param state
+//  The state to search for transitions in (assumed not null).
+//
+// @return
+//  The transition to take on \e symbol or null if there was no such 
+//  transition from \e state.
+*/
+inline const ParserTransition* find_parser_transition( const ParserStateMachine* state_machine, const ParserSymbol* symbol, const ParserState* state )
+{
+    LALR_ASSERT( state_machine );
+    LALR_ASSERT( state );
+
+    const int* action_table = state_machine->action_table;
+    if ( action_table )
+    {
+        if ( symbol )
+        {
+            int index = action_table[state->index * state_machine->symbols_size + symbol->index];
+            return index != ParserTransition::INVALID_INDEX ? &state_machine->transitions[index] : nullptr;
+        }
+        return nullptr;
+    }
+
+    const int* base_table = state_machine->base_table;
+    if ( base_table )
+    {
+        if ( symbol )
+        {
+            int index = base_table[state->index] + symbol->index;
+            if ( state_machine->check_table[index] == state->index )
+            {
+                return &state_machine->transitions[state_machine->next_table[index]];
+            }
+            if ( symbol->type != SYMBOL_NON_TERMINAL && symbol != state_machine->error_symbol )
+            {
+                int default_index = state_machine->default_table[state->index];
+                return default_index != ParserTransition::INVALID_INDEX ? &state_machine->transitions[default_index] : nullptr;
+            }
+        }
+        return nullptr;
+    }
+
+    const ParserTransition* transition = state->transitions;
+    const ParserTransition* transitions_end = state->transitions + state->length;
+    while ( transition != transitions_end && transition->symbol != symbol )
+    {
+        ++transition;
+    }
+    return transition != transitions_end ? transition : nullptr;
+}
+
+/**
+// Find the state transitioned to after reducing to \e symbol in \e state.
+//
+// @param state_machine
+//  The state machine to find the state in (assumed not null).
+//
+// @param symbol
+//  The non-terminal symbol that has just been reduced to (assumed not null).
+//
+// @param state
+//  The state uncovered on the stack by the reduction (assumed not null).
+//
+// @return
+//  The state to transition to or null if there is no such transition from
+//  \e state.
+*/
+inline const ParserState* find_parser_goto( const ParserStateMachine* state_machine, const ParserSymbol* symbol, const ParserState* state )
+{
+    LALR_ASSERT( state_machine );
+    LALR_ASSERT( symbol );
+    LALR_ASSERT( state );
+
+    const int* goto_table = state_machine->goto_table;
+    if ( goto_table )
+    {
+        int index = goto_table[state->index * state_machine->symbols_size + symbol->index];
+        return index != ParserState::INVALID_INDEX ? &state_machine->states[index] : nullptr;
+    }
+
+    const ParserTransition* transition = find_parser_transition( state_machine, symbol, state );
+    return transition ? transition->state : nullptr;
+}
+
+}
+
+#endif
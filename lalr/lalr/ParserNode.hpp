@@ -10,6 +10,7 @@ namespace lalr
 
 class ParserSymbol;
 class ParserState;
+template <class Char> class PositionIndex;
 
 /**
 // An element in the parser's stack when parsing.
@@ -19,18 +20,32 @@ class ParserNode
 {
     const ParserState* state_; ///< The state at this node.
     const ParserSymbol* symbol_; ///< The symbol at this node.
-    std::basic_string<Char, Traits, Allocator> lexeme_; ///< The lexeme at this node (empty if this node's symbol is non-terminal).
-    int line_; ///< The line number at the start of the lexeme at this node.
-    int column_; ///< The column number at the start of the lexeme at this node.
+    mutable std::basic_string<Char, Traits, Allocator> lexeme_; ///< The lexeme at this node (empty if this node's symbol is non-terminal or until a borrowed lexeme is first requested).
+    const Char* lexeme_begin_; ///< The first character of the lexeme borrowed from the input at this node or null if the lexeme is owned.
+    const Char* lexeme_end_; ///< One past the last character of the lexeme borrowed from the input at this node or null if the lexeme is owned.
+    mutable int line_; ///< The line number at the start of the lexeme at this node (once resolved when positions_ isn't null).
+    mutable int column_; ///< The column number at the start of the lexeme at this node (once resolved when positions_ isn't null).
+    mutable const PositionIndex<Char>* positions_; ///< The index to resolve position_ to a line and column with or null if line_ and column_ are resolved.
+    const Char* position_; ///< The position in the input at the start of the lexeme at this node while it is yet to be resolved.
 
     public:
         ParserNode( const ParserState* state, const ParserSymbol* symbol, int line, int column );
         ParserNode( const ParserState* state, const ParserSymbol* symbol, const std::basic_string<Char, Traits, Allocator>& lexeme, int line, int column );
+        ParserNode( const ParserState* state, const ParserSymbol* symbol, const Char* lexeme_begin, const Char* lexeme_end, int line, int column );
         const ParserState* state() const;
         const ParserSymbol* symbol() const;
         const std::basic_string<Char, Traits, Allocator>& lexeme() const;
+        const Char* lexeme_begin() const;
+        const Char* lexeme_end() const;
+        size_t lexeme_length() const;
+        bool lexeme_borrowed() const;
         int line() const;
         int column() const;
+        void set_position( const PositionIndex<Char>* positions, const Char* position );
+        void set_position( const ParserNode& node );
+
+    private:
+        void resolve() const;
 };
 
 }
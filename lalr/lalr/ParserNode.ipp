@@ -2,6 +2,7 @@
 #define LALR_PARSERNODE_IPP_INCLUDED
 
 #include "ParserNode.hpp"
+#include "PositionIndex.hpp"
 #include "assert.hpp"
 
 namespace lalr
@@ -30,8 +31,12 @@ ParserNode<Char, Traits, Allocator>::ParserNode( const ParserState* state, const
 : state_( state ),
   symbol_( symbol ),
   lexeme_(),
+  lexeme_begin_( nullptr ),
+  lexeme_end_( nullptr ),
   line_( line ),
-  column_( column )
+  column_( column ),
+  positions_( nullptr ),
+  position_( nullptr )
 {
     LALR_ASSERT( state );
     LALR_ASSERT( line >= 0 );
@@ -64,14 +69,64 @@ ParserNode<Char, Traits, Allocator>::ParserNode( const ParserState* state, const
 : state_( state ),
   symbol_( symbol ),
   lexeme_( lexeme ),
+  lexeme_begin_( nullptr ),
+  lexeme_end_( nullptr ),
   line_( line ),
-  column_( column )
+  column_( column ),
+  positions_( nullptr ),
+  position_( nullptr )
 {
     LALR_ASSERT( state );
     LALR_ASSERT( line >= 0 );
     LALR_ASSERT( column >= 1 );
 }
 
+/**
+// Constructor.
+//
+// The lexeme is borrowed from the input rather than copied and so 
+// [\e lexeme_begin, \e lexeme_end) must remain valid for the lifetime of 
+// this node.
+//
+// @param state
+//  The state at this node.
+//
+// @param symbol
+//  The symbol at this node.
+//
+// @param lexeme_begin
+//  The first character of the lexeme at this node (assumed not null).
+//
+// @param lexeme_end
+//  One past the last character of the lexeme at this node (assumed not 
+//  null).
+//
+// @param line
+//  The line number at the start of the lexeme (assumed >= 0).
+//
+// @param column
+//  The column number at the start of the lexeme (assumed >= 1).
+*/
+template <class Char, class Traits, class Allocator>
+ParserNode<Char, Traits, Allocator>::ParserNode( const ParserState* state, const ParserSymbol* symbol, const Char* lexeme_begin, const Char* lexeme_end, int line, int column )
+: state_( state ),
+  symbol_( symbol ),
+  lexeme_(),
+  lexeme_begin_( lexeme_begin ),
+  lexeme_end_( lexeme_end ),
+  line_( line ),
+  column_( column ),
+  positions_( nullptr ),
+  position_( nullptr )
+{
+    LALR_ASSERT( state );
+    LALR_ASSERT( lexeme_begin );
+    LALR_ASSERT( lexeme_end );
+    LALR_ASSERT( lexeme_begin <= lexeme_end );
+    LALR_ASSERT( line >= 0 );
+    LALR_ASSERT( column >= 1 );
+}
+
 /**
 // Get the state at this node.
 //
@@ -99,15 +154,72 @@ const ParserSymbol* ParserNode<Char, Traits, Allocator>::symbol() const
 /**
 // Get the lexeme at this state.
 //
+// A lexeme borrowed from the input is copied the first time that it is 
+// requested; use ParserNode::lexeme_begin() and ParserNode::lexeme_end() to
+// access it without copying.
+//
 // @return
 //  The lexeme.
 */
 template <class Char, class Traits, class Allocator>
 const std::basic_string<Char, Traits, Allocator>& ParserNode<Char, Traits, Allocator>::lexeme() const
 {
+    if ( lexeme_begin_ != lexeme_end_ && lexeme_.empty() )
+    {
+        lexeme_.assign( lexeme_begin_, lexeme_end_ );
+    }
     return lexeme_;
 }
 
+/**
+// Get the first character of the lexeme at this state.
+//
+// @return
+//  The first character of the lexeme.
+*/
+template <class Char, class Traits, class Allocator>
+const Char* ParserNode<Char, Traits, Allocator>::lexeme_begin() const
+{
+    return lexeme_begin_ ? lexeme_begin_ : lexeme_.data();
+}
+
+/**
+// Get one past the last character of the lexeme at this state.
+//
+// @return
+//  One past the last character of the lexeme.
+*/
+template <class Char, class Traits, class Allocator>
+const Char* ParserNode<Char, Traits, Allocator>::lexeme_end() const
+{
+    return lexeme_begin_ ? lexeme_end_ : lexeme_.data() + lexeme_.size();
+}
+
+/**
+// Is the lexeme at this state borrowed from the input?
+//
+// @return
+//  True if the lexeme is borrowed from the input and so remains valid for
+//  as long as the input does or false if the lexeme is owned by this node.
+*/
+template <class Char, class Traits, class Allocator>
+bool ParserNode<Char, Traits, Allocator>::lexeme_borrowed() const
+{
+    return lexeme_begin_ != nullptr;
+}
+
+/**
+// Get the length of the lexeme at this state.
+//
+// @return
+//  The number of characters in the lexeme.
+*/
+template <class Char, class Traits, class Allocator>
+size_t ParserNode<Char, Traits, Allocator>::lexeme_length() const
+{
+    return lexeme_begin_ ? size_t(lexeme_end_ - lexeme_begin_) : lexeme_.size();
+}
+
 /**
 // Get the line number at the start of this node's lexeme.
 //
@@ -117,6 +229,7 @@ const std::basic_string<Char, Traits, Allocator>& ParserNode<Char, Traits, Alloc
 template <class Char, class Traits, class Allocator>
 int ParserNode<Char, Traits, Allocator>::line() const
 {
+    resolve();
     return line_;
 }
 
@@ -129,9 +242,60 @@ int ParserNode<Char, Traits, Allocator>::line() const
 template <class Char, class Traits, class Allocator>
 int ParserNode<Char, Traits, Allocator>::column() const
 {
+    resolve();
     return column_;
 }
 
+/**
+// Set the position of this node to be resolved to a line and column 
+// number from \e positions the first time either is requested.
+//
+// @param positions
+//  The index of the input that \e position is in (assumed not null).
+//
+// @param position
+//  The position in the input at the start of the lexeme at this node 
+//  (assumed not null).
+*/
+template <class Char, class Traits, class Allocator>
+void ParserNode<Char, Traits, Allocator>::set_position( const PositionIndex<Char>* positions, const Char* position )
+{
+    LALR_ASSERT( positions );
+    LALR_ASSERT( position );
+    positions_ = positions;
+    position_ = position;
+}
+
+/**
+// Set the position of this node to the position of \e node without 
+// resolving it.
+//
+// @param node
+//  The node to take the position of.
+*/
+template <class Char, class Traits, class Allocator>
+void ParserNode<Char, Traits, Allocator>::set_position( const ParserNode& node )
+{
+    line_ = node.line_;
+    column_ = node.column_;
+    positions_ = node.positions_;
+    position_ = node.position_;
+}
+
+/**
+// Resolve the line and column number of this node if they have been 
+// deferred.
+*/
+template <class Char, class Traits, class Allocator>
+void ParserNode<Char, Traits, Allocator>::resolve() const
+{
+    if ( positions_ )
+    {
+        positions_->resolve( position_, &line_, &column_ );
+        positions_ = nullptr;
+    }
+}
+
 }
 
 #endif
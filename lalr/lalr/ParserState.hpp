@@ -13,9 +13,11 @@ class ParserTransition;
 class ParserState
 {
 public:
+    static const int INVALID_INDEX = -1;
     int index; ///< The index of this state.
     int length; ///< The number of transitions in this state.
     const ParserTransition* transitions; ///< The available transitions from this state.
+    const ParserTransition* default_transition; ///< The reduction taken from this state on any lookahead or null if the lookahead must be examined.
 };
 
 }
@@ -23,6 +23,8 @@ class ParserState;
 class ParserStateMachine
 {
 public:
+    static const int MAXIMUM_STATES = 65536; ///< The most states that a Parser is able to index on its stack.
+
     const char* identifier;
     int actions_size;
     int symbols_size;
@@ -38,6 +40,13 @@ public:
     const ParserState* start_state; ///< The start state.
     const LexerStateMachine* lexer_state_machine; ///< The state machine used by the lexer to match tokens
     const LexerStateMachine* whitespace_lexer_state_machine; ///< The state machine used by the lexer to skip whitespace
+    const int* action_table; ///< Transition indices addressed by state and symbol index (-1 for no transition) or null to search transitions instead.
+    const int* goto_table; ///< State indices transitioned to after reducing to a non-terminal addressed by state and symbol index or null to search transitions instead.
+    int compressed_table_size; ///< The number of entries in the compressed next and check tables.
+    const int* default_table; ///< Default reduce transition indices addressed by state index (-1 for no default) or null if there are no compressed tables.
+    const int* base_table; ///< Offsets of each state's row into the compressed next and check tables addressed by state index or null if there are no compressed tables.
+    const int* next_table; ///< Transition indices addressed by a state's base plus symbol index.
+    const int* check_table; ///< State indices that own each entry in the compressed next table (-1 for an unused entry).
 };
 
 }
@@ -15,6 +15,7 @@ class ParserSymbol;
 class ParserTransition
 {
 public:
+    static const int INVALID_INDEX = -1;
     const ParserSymbol* symbol; ///< The symbol that the transition is taken on.
     const ParserState* state; ///< The state that is transitioned to.
     const ParserSymbol* reduced_symbol; ///< The symbol that is reduced to or null if this isn't a reducing transition.
@@ -0,0 +1,65 @@
+#ifndef LALR_PARSERTREE_HPP_INCLUDED
+#define LALR_PARSERTREE_HPP_INCLUDED
+
+#include "Parser.hpp"
+#include "ParserTreeNode.hpp"
+#include "ParserTreeCursor.hpp"
+#include <vector>
+#include <memory>
+#include <string>
+
+namespace lalr
+{
+
+class ParserSymbol;
+class ParserStateMachine;
+
+/**
+// A parse tree stored as a flat array of nodes in an arena.
+//
+// A ParserTree is an alternative to building a tree of ParserUserData 
+// when a parser's user data is just the parse tree.  Instead of a separate 
+// reference counted allocation per node, with a vector of children and a 
+// copy of its lexeme, each node is appended to a single array and refers 
+// to its first child and next sibling by index.  Nodes span the source
+// they were parsed from; from the start of their first token to the end of
+// their last.  Lexemes that aren't borrowed from the input (see 
+// Parser::set_zero_copy_lexemes_enabled()) are copied into blocks owned by
+// the tree, in which case the spans of terminals are still their lexemes 
+// but the spans of non-terminals aren't meaningful.
+//
+// A tree is built by binding it to a Parser that uses the node index as 
+// its user data; Parser::user_data() is then the index of the root after
+// an accepted parse.  Calling ParserTree::reset() frees all of the nodes
+// at once while keeping the memory for the next parse.
+*/
+template <class Char, class Traits = std::char_traits<Char>, class Allocator = std::allocator<Char>>
+class ParserTree
+{
+    typedef lalr::ParserNode<Char, Traits, Allocator> ParserNode;
+    static const size_t BLOCK_SIZE = 4096;
+
+    const ParserStateMachine* state_machine_; ///< The state machine whose symbols are referred to by the nodes in this tree.
+    std::vector<ParserTreeNode<Char>> nodes_; ///< The nodes in this tree in the order that they were reduced.
+    std::vector<std::vector<Char>> blocks_; ///< Blocks of memory that hold copies of lexemes not borrowed from the input.
+    size_t block_; ///< The index of the block that lexemes are currently copied into.
+
+    public:
+        ParserTree( const ParserStateMachine* state_machine );
+        template <class Iterator> void bind( Parser<Iterator, int, Char, Traits, Allocator>* parser );
+        void reset();
+        size_t size() const;
+        const ParserTreeNode<Char>& node( int index ) const;
+        const ParserSymbol* symbol( int index ) const;
+        ParserTreeCursor<Char, Traits, Allocator> root() const;
+        ParserTreeCursor<Char, Traits, Allocator> cursor( int index ) const;
+        int reduce( const ParserSymbol* symbol, const int* user_data, const ParserNode* nodes, size_t length );
+
+    private:
+        int add_node( int symbol, const Char* begin, const Char* end );
+        const Char* copy( const std::basic_string<Char, Traits, Allocator>& lexeme );
+};
+
+}
+
+#endif
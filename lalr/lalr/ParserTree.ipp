@@ -0,0 +1,259 @@
+#ifndef LALR_PARSERTREE_IPP_INCLUDED
+#define LALR_PARSERTREE_IPP_INCLUDED
+
+#include "ParserTree.hpp"
+#include "ParserTreeCursor.ipp"
+#include "Parser.ipp"
+#include "ParserSymbol.hpp"
+#include "ParserStateMachine.hpp"
+#include "assert.hpp"
+#include <algorithm>
+
+namespace lalr
+{
+
+/**
+// Constructor.
+//
+// @param state_machine
+//  The state machine that the parsers this tree is bound to use (assumed 
+//  not null).
+*/
+template <class Char, class Traits, class Allocator>
+ParserTree<Char, Traits, Allocator>::ParserTree( const ParserStateMachine* state_machine )
+: state_machine_( state_machine ),
+  nodes_(),
+  blocks_(),
+  block_( 0 )
+{
+    LALR_ASSERT( state_machine_ );
+}
+
+/**
+// Build this tree from the reductions made by \e parser.
+//
+// Sets \e parser's default action handler to add a node to this tree for 
+// each reduction.  Any other parser action handlers that are set on 
+// \e parser take precedence and must return the index of a node in this 
+// tree for the tree to remain well formed.
+//
+// @param parser
+//  The parser to build this tree from (assumed not null and to use the 
+//  same state machine as this tree).
+*/
+template <class Char, class Traits, class Allocator>
+template <class Iterator>
+void ParserTree<Char, Traits, Allocator>::bind( Parser<Iterator, int, Char, Traits, Allocator>* parser )
+{
+    LALR_ASSERT( parser );
+    parser->set_default_action_handler( [this, parser] (const int* user_data, const ParserNode* nodes, size_t length)
+    {
+        return reduce( parser->reduced_symbol(), user_data, nodes, length );
+    } );
+}
+
+/**
+// Free all of the nodes in this tree.
+//
+// The memory used by the nodes and any copied lexemes is kept so that the
+// next tree built needn't allocate it again.
+*/
+template <class Char, class Traits, class Allocator>
+void ParserTree<Char, Traits, Allocator>::reset()
+{
+    nodes_.clear();
+    for ( typename std::vector<std::vector<Char>>::iterator block = blocks_.begin(); block != blocks_.end(); ++block )
+    {
+        block->clear();
+    }
+    block_ = 0;
+}
+
+/**
+// Get the number of nodes in this tree.
+//
+// @return
+//  The number of nodes.
+*/
+template <class Char, class Traits, class Allocator>
+size_t ParserTree<Char, Traits, Allocator>::size() const
+{
+    return nodes_.size();
+}
+
+/**
+// Get a node in this tree.
+//
+// @param index
+//  The index of the node (assumed to be a valid node index).
+//
+// @return
+//  The node.
+*/
+template <class Char, class Traits, class Allocator>
+const ParserTreeNode<Char>& ParserTree<Char, Traits, Allocator>::node( int index ) const
+{
+    LALR_ASSERT( index >= 0 && index < int(nodes_.size()) );
+    return nodes_[index];
+}
+
+/**
+// Get a symbol referred to by the nodes in this tree.
+//
+// @param index
+//  The index of the symbol (assumed to be a valid symbol index).
+//
+// @return
+//  The symbol.
+*/
+template <class Char, class Traits, class Allocator>
+const ParserSymbol* ParserTree<Char, Traits, Allocator>::symbol( int index ) const
+{
+    LALR_ASSERT( index >= 0 && index < state_machine_->symbols_size );
+    return &state_machine_->symbols[index];
+}
+
+/**
+// Get a cursor at the root of this tree.
+//
+// Nodes are added as their productions are reduced so the root, the node
+// added by the final reduction, is always the last node in the tree.
+//
+// @return
+//  The cursor at the root (not valid if this tree is empty).
+*/
+template <class Char, class Traits, class Allocator>
+ParserTreeCursor<Char, Traits, Allocator> ParserTree<Char, Traits, Allocator>::root() const
+{
+    return ParserTreeCursor<Char, Traits, Allocator>( this, int(nodes_.size()) - 1 );
+}
+
+/**
+// Get a cursor at a node in this tree.
+//
+// @param index
+//  The index of the node, e.g. from Parser::user_data().
+//
+// @return
+//  The cursor at the node.
+*/
+template <class Char, class Traits, class Allocator>
+ParserTreeCursor<Char, Traits, Allocator> ParserTree<Char, Traits, Allocator>::cursor( int index ) const
+{
+    return ParserTreeCursor<Char, Traits, Allocator>( this, index );
+}
+
+/**
+// Add a node for a reduction to this tree.
+//
+// A leaf node is added for each terminal in the reduced production 
+// followed by the node for the reduction itself with the leaves and the 
+// nodes of any non-terminals, from \e user_data, as its children.
+//
+// @param symbol
+//  The symbol being reduced to (assumed not null).
+//
+// @param user_data
+//  The user data for the symbols in the reduced production; the indices of 
+//  the nodes for any non-terminals.
+//
+// @param nodes
+//  The parser nodes for the symbols in the reduced production.
+//
+// @param length
+//  The number of symbols in the reduced production.
+//
+// @return
+//  The index of the node added for the reduction.
+*/
+template <class Char, class Traits, class Allocator>
+int ParserTree<Char, Traits, Allocator>::reduce( const ParserSymbol* symbol, const int* user_data, const ParserNode* nodes, size_t length )
+{
+    LALR_ASSERT( symbol );
+    LALR_ASSERT( length == 0 || (user_data && nodes) );
+
+    int first_child = ParserTreeNode<Char>::INVALID_INDEX;
+    int last_child = ParserTreeNode<Char>::INVALID_INDEX;
+    const Char* begin = nullptr;
+    const Char* end = nullptr;
+    for ( size_t i = 0; i < length; ++i )
+    {
+        const ParserNode& node = nodes[i];
+        int child = user_data[i];
+        if ( node.symbol()->type != SYMBOL_NON_TERMINAL )
+        {
+            const Char* lexeme_begin = node.lexeme_begin();
+            const Char* lexeme_end = node.lexeme_end();
+            if ( !node.lexeme_borrowed() )
+            {
+                lexeme_begin = copy( node.lexeme() );
+                lexeme_end = lexeme_begin + node.lexeme().size();
+            }
+            child = add_node( node.symbol()->index, lexeme_begin, lexeme_end );
+        }
+        LALR_ASSERT( child >= 0 && child < int(nodes_.size()) );
+        if ( nodes_[child].begin )
+        {
+            begin = begin ? begin : nodes_[child].begin;
+            end = nodes_[child].end;
+        }
+        if ( last_child != ParserTreeNode<Char>::INVALID_INDEX )
+        {
+            nodes_[last_child].next_sibling = child;
+        }
+        else
+        {
+            first_child = child;
+        }
+        last_child = child;
+    }
+
+    int index = add_node( symbol->index, begin, end );
+    nodes_[index].first_child = first_child;
+    return index;
+}
+
+/**
+// Append a node with no children or siblings to this tree.
+//
+// @return
+//  The index of the appended node.
+*/
+template <class Char, class Traits, class Allocator>
+int ParserTree<Char, Traits, Allocator>::add_node( int symbol, const Char* begin, const Char* end )
+{
+    ParserTreeNode<Char> node = { symbol, ParserTreeNode<Char>::INVALID_INDEX, ParserTreeNode<Char>::INVALID_INDEX, begin, end };
+    nodes_.push_back( node );
+    return int(nodes_.size()) - 1;
+}
+
+/**
+// Copy a lexeme into the blocks owned by this tree.
+//
+// Blocks never grow beyond the capacity they're created with so copies 
+// already made stay where they are.
+//
+// @return
+//  The first character of the copy.
+*/
+template <class Char, class Traits, class Allocator>
+const Char* ParserTree<Char, Traits, Allocator>::copy( const std::basic_string<Char, Traits, Allocator>& lexeme )
+{
+    while ( block_ < blocks_.size() && blocks_[block_].capacity() - blocks_[block_].size() < lexeme.size() )
+    {
+        ++block_;
+    }
+    if ( block_ == blocks_.size() )
+    {
+        blocks_.push_back( std::vector<Char>() );
+        blocks_.back().reserve( std::max(lexeme.size(), size_t(BLOCK_SIZE)) );
+    }
+    std::vector<Char>& block = blocks_[block_];
+    size_t offset = block.size();
+    block.insert( block.end(), lexeme.begin(), lexeme.end() );
+    return block.data() + offset;
+}
+
+}
+
+#endif
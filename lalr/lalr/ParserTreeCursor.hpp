@@ -0,0 +1,40 @@
+#ifndef LALR_PARSERTREECURSOR_HPP_INCLUDED
+#define LALR_PARSERTREECURSOR_HPP_INCLUDED
+
+#include <memory>
+#include <string>
+
+namespace lalr
+{
+
+class ParserSymbol;
+template <class Char, class Traits, class Allocator> class ParserTree;
+
+/**
+// A lightweight position in a ParserTree used to walk it.
+//
+// Cursors are small values that are cheap to copy; they remain valid until
+// the tree they refer to is reset or destroyed.
+*/
+template <class Char, class Traits = std::char_traits<Char>, class Allocator = std::allocator<Char>>
+class ParserTreeCursor
+{
+    const ParserTree<Char, Traits, Allocator>* tree_; ///< The tree that this cursor walks.
+    int index_; ///< The index of the node that this cursor is at or ParserTreeNode::INVALID_INDEX if this cursor isn't at a node.
+
+    public:
+        ParserTreeCursor( const ParserTree<Char, Traits, Allocator>* tree, int index );
+        bool valid() const;
+        int index() const;
+        const ParserSymbol* symbol() const;
+        const Char* begin() const;
+        const Char* end() const;
+        std::basic_string<Char, Traits, Allocator> lexeme() const;
+        ParserTreeCursor first_child() const;
+        ParserTreeCursor next_sibling() const;
+        size_t children() const;
+};
+
+}
+
+#endif
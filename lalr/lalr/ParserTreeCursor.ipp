@@ -0,0 +1,158 @@
+#ifndef LALR_PARSERTREECURSOR_IPP_INCLUDED
+#define LALR_PARSERTREECURSOR_IPP_INCLUDED
+
+#include "ParserTreeCursor.hpp"
+#include "ParserTree.hpp"
+#include "ParserTreeNode.hpp"
+#include "assert.hpp"
+
+namespace lalr
+{
+
+/**
+// Constructor.
+//
+// @param tree
+//  The tree to walk (assumed not null).
+//
+// @param index
+//  The index of the node to start at or ParserTreeNode::INVALID_INDEX for 
+//  a cursor that isn't at any node.
+*/
+template <class Char, class Traits, class Allocator>
+ParserTreeCursor<Char, Traits, Allocator>::ParserTreeCursor( const ParserTree<Char, Traits, Allocator>* tree, int index )
+: tree_( tree ),
+  index_( index )
+{
+    LALR_ASSERT( tree_ );
+    LALR_ASSERT( index_ >= ParserTreeNode<Char>::INVALID_INDEX && index_ < int(tree_->size()) );
+}
+
+/**
+// Is this cursor at a node?
+//
+// @return
+//  True if this cursor is at a node otherwise false.
+*/
+template <class Char, class Traits, class Allocator>
+bool ParserTreeCursor<Char, Traits, Allocator>::valid() const
+{
+    return index_ != ParserTreeNode<Char>::INVALID_INDEX;
+}
+
+/**
+// Get the index of the node this cursor is at.
+//
+// @return
+//  The index of the node or ParserTreeNode::INVALID_INDEX if this cursor 
+//  isn't at a node.
+*/
+template <class Char, class Traits, class Allocator>
+int ParserTreeCursor<Char, Traits, Allocator>::index() const
+{
+    return index_;
+}
+
+/**
+// Get the symbol at the node this cursor is at.
+//
+// @return
+//  The symbol.
+*/
+template <class Char, class Traits, class Allocator>
+const ParserSymbol* ParserTreeCursor<Char, Traits, Allocator>::symbol() const
+{
+    LALR_ASSERT( valid() );
+    return tree_->symbol( tree_->node(index_).symbol );
+}
+
+/**
+// Get the first character of the source spanned by the node this cursor is
+// at.
+//
+// @return
+//  The first character or null if the node spans no tokens.
+*/
+template <class Char, class Traits, class Allocator>
+const Char* ParserTreeCursor<Char, Traits, Allocator>::begin() const
+{
+    LALR_ASSERT( valid() );
+    return tree_->node( index_ ).begin;
+}
+
+/**
+// Get one past the last character of the source spanned by the node this 
+// cursor is at.
+//
+// @return
+//  One past the last character or null if the node spans no tokens.
+*/
+template <class Char, class Traits, class Allocator>
+const Char* ParserTreeCursor<Char, Traits, Allocator>::end() const
+{
+    LALR_ASSERT( valid() );
+    return tree_->node( index_ ).end;
+}
+
+/**
+// Get a copy of the source spanned by the node this cursor is at.
+//
+// @return
+//  The source spanned by the node.
+*/
+template <class Char, class Traits, class Allocator>
+std::basic_string<Char, Traits, Allocator> ParserTreeCursor<Char, Traits, Allocator>::lexeme() const
+{
+    LALR_ASSERT( valid() );
+    const ParserTreeNode<Char>& node = tree_->node( index_ );
+    return node.begin ? std::basic_string<Char, Traits, Allocator>( node.begin, node.end ) : std::basic_string<Char, Traits, Allocator>();
+}
+
+/**
+// Get a cursor at the first child of the node this cursor is at.
+//
+// @return
+//  The cursor at the first child (not valid if the node has no children).
+*/
+template <class Char, class Traits, class Allocator>
+ParserTreeCursor<Char, Traits, Allocator> ParserTreeCursor<Char, Traits, Allocator>::first_child() const
+{
+    LALR_ASSERT( valid() );
+    return ParserTreeCursor( tree_, tree_->node(index_).first_child );
+}
+
+/**
+// Get a cursor at the next sibling of the node this cursor is at.
+//
+// @return
+//  The cursor at the next sibling (not valid if the node is the last 
+//  child of its parent).
+*/
+template <class Char, class Traits, class Allocator>
+ParserTreeCursor<Char, Traits, Allocator> ParserTreeCursor<Char, Traits, Allocator>::next_sibling() const
+{
+    LALR_ASSERT( valid() );
+    return ParserTreeCursor( tree_, tree_->node(index_).next_sibling );
+}
+
+/**
+// Count the children of the node this cursor is at.
+//
+// @return
+//  The number of children.
+*/
+template <class Char, class Traits, class Allocator>
+size_t ParserTreeCursor<Char, Traits, Allocator>::children() const
+{
+    LALR_ASSERT( valid() );
+    size_t children = 0;
+    for ( int child = tree_->node(index_).first_child; child != ParserTreeNode<Char>::INVALID_INDEX; child = tree_->node(child).next_sibling )
+    {
+        ++children;
+    }
+    return children;
+}
+
+}
+
+#endif
@@ -0,0 +1,27 @@
+#ifndef LALR_PARSERTREENODE_HPP_INCLUDED
+#define LALR_PARSERTREENODE_HPP_INCLUDED
+
+namespace lalr
+{
+
+/**
+// A node in a ParserTree.
+//
+// Nodes refer to each other by their index in the tree rather than by
+// pointer so that the tree can grow without invalidating them.
+*/
+template <class Char>
+class ParserTreeNode
+{
+public:
+    static const int INVALID_INDEX = -1;
+    int symbol; ///< The index of the symbol at this node.
+    int first_child; ///< The index of this node's first child or INVALID_INDEX if this node has no children.
+    int next_sibling; ///< The index of this node's next sibling or INVALID_INDEX if this node is its parent's last child.
+    const Char* begin; ///< The first character of the source spanned by this node or null if this node spans no tokens.
+    const Char* end; ///< One past the last character of the source spanned by this node or null if this node spans no tokens.
+};
+
+}
+
+#endif
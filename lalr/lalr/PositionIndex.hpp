@@ -0,0 +1,114 @@
+#ifndef LALR_POSITIONINDEX_HPP_INCLUDED
+#define LALR_POSITIONINDEX_HPP_INCLUDED
+
+#include "assert.hpp"
+#include "simd.hpp"
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+#include <cstddef>
+
+namespace lalr
+{
+
+/**
+// An index of the line breaks in contiguous input that resolves positions
+// in that input to line and column numbers on demand.
+//
+// The index isn't built until the first position is resolved so input
+// that is parsed without any positions being requested is never scanned
+// for line breaks.  Line breaks are counted in the same way as
+// PositionIterator counts them; a new line starts after each '\n' and
+// after each '\r' that isn't followed by '\n'.
+*/
+template <class Char>
+class PositionIndex
+{
+    const Char* begin_; ///< The first character of the input.
+    const Char* end_; ///< One past the last character of the input.
+    mutable std::vector<std::size_t> lines_; ///< The offset of the first character of each line after the first.
+    mutable bool indexed_; ///< True once lines_ has been built otherwise false.
+
+    public:
+        PositionIndex()
+        : begin_( nullptr ),
+          end_( nullptr ),
+          lines_(),
+          indexed_( false )
+        {
+        }
+
+        void reset( const Char* begin, const Char* end )
+        {
+            LALR_ASSERT( begin <= end );
+            begin_ = begin;
+            end_ = end;
+            lines_.clear();
+            indexed_ = false;
+        }
+
+        void resolve( const Char* position, int* line, int* column ) const
+        {
+            LALR_ASSERT( position >= begin_ && position <= end_ );
+            LALR_ASSERT( line );
+            LALR_ASSERT( column );
+            if ( !indexed_ )
+            {
+                index( std::integral_constant<bool, sizeof(Char) == 1>() );
+                indexed_ = true;
+            }
+            std::size_t offset = std::size_t(position - begin_);
+            std::size_t lines = std::size_t(std::upper_bound(lines_.begin(), lines_.end(), offset) - lines_.begin());
+            std::size_t line_begin = lines > 0 ? lines_[lines - 1] : 0;
+            *line = int(lines + 1);
+            *column = int(offset - line_begin + 1);
+        }
+
+    private:
+        void add_line_break( const Char* position ) const
+        {
+            if ( *position == '\n' || (*position == '\r' && (position + 1 == end_ || position[1] != '\n')) )
+            {
+                lines_.push_back( std::size_t(position + 1 - begin_) );
+            }
+        }
+
+        void index( std::true_type /*bytes*/ ) const
+        {
+            const Char* i = begin_;
+#if LALR_LEXER_SIMD
+            const int BYTES = 16;
+            const __m128i newlines = _mm_set1_epi8( '\n' );
+            const __m128i returns = _mm_set1_epi8( '\r' );
+            while ( end_ - i >= BYTES )
+            {
+                __m128i characters = _mm_loadu_si128( reinterpret_cast<const __m128i*>(i) );
+                __m128i line_breaks = _mm_or_si128( _mm_cmpeq_epi8(characters, newlines), _mm_cmpeq_epi8(characters, returns) );
+                unsigned int mask = unsigned(_mm_movemask_epi8(line_breaks));
+                while ( mask != 0 )
+                {
+                    add_line_break( i + count_trailing_zeros(mask) );
+                    mask &= mask - 1;
+                }
+                i += BYTES;
+            }
+#endif
+            while ( i != end_ )
+            {
+                add_line_break( i );
+                ++i;
+            }
+        }
+
+        void index( std::false_type /*bytes*/ ) const
+        {
+            for ( const Char* i = begin_; i != end_; ++i )
+            {
+                add_line_break( i );
+            }
+        }
+};
+
+}
+
+#endif
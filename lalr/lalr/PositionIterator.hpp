@@ -27,6 +27,8 @@ class PositionIterator
         bool ended_; ///< True if this iterator has reached its end.
         int line_; ///< The current line number of this iterator.
         int column_; ///< The current column number of this iterator.
+        bool lines_; ///< True if this iterator counts lines and columns otherwise false.
+        bool ended_on_return_; ///< True if this iterator ended on a '\r' that may be followed by a '\n' when it is resumed otherwise false.
     
     public:
         PositionIterator()
@@ -34,16 +36,20 @@ class PositionIterator
           end_(),
           ended_( true ),
           line_( 1 ),
-          column_( 1 )
+          column_( 1 ),
+          lines_( true ),
+          ended_on_return_( false )
         {
         }
     
-        PositionIterator( Iterator begin, Iterator end )
+        PositionIterator( Iterator begin, Iterator end, bool lines = true )
         : position_( begin ),
           end_( end ),
           ended_( begin == end ),
           line_( 1 ),
-          column_( 1 )
+          column_( 1 ),
+          lines_( lines ),
+          ended_on_return_( false )
         {
         }        
         
@@ -52,7 +58,9 @@ class PositionIterator
           end_( iterator.end_ ),
           ended_( iterator.ended_ ),
           line_( iterator.line_ ),
-          column_(iterator.column_)
+          column_(iterator.column_),
+          lines_( iterator.lines_ ),
+          ended_on_return_( iterator.ended_on_return_ )
         {
         }
                 
@@ -65,6 +73,8 @@ class PositionIterator
                 ended_ = iterator.ended_;
                 line_ = iterator.line_;
                 column_ = iterator.column_;
+                lines_ = iterator.lines_;
+                ended_on_return_ = iterator.ended_on_return_;
             }
             
             return *this;
@@ -72,16 +82,24 @@ class PositionIterator
                 
         PositionIterator& operator++()
         {
-            int character = *position_;
-            ++position_;
-            ++column_;
-            if ( character == '\n' || (character == '\r' && (position_ == end_ || *position_ != '\n')) )
+            if ( lines_ )
             {
-                ++line_;
-                column_ = 1;
+                int character = *position_;
+                ++position_;
+                ++column_;
+                ended_ = position_ == end_;
+                if ( character == '\n' || (character == '\r' && (ended_ || *position_ != '\n')) )
+                {
+                    ++line_;
+                    column_ = 1;
+                    ended_on_return_ = ended_ && character == '\r';
+                }
+            }
+            else
+            {
+                ++position_;
+                ended_ = position_ == end_;
             }
-            
-            ended_ = position_ == end_;
             return *this;
         }
                 
@@ -125,6 +143,37 @@ class PositionIterator
             return ended_ || iterator.ended_ ? ended_ == iterator.ended_ : position_ == iterator.position_;
         }
 
+        void advance( Iterator position, bool line_breaks )
+        {
+            if ( line_breaks && lines_ )
+            {
+                while ( position_ != position )
+                {
+                    operator++();
+                }
+            }
+            else
+            {
+                column_ += int(std::distance(position_, position));
+                position_ = position;
+                ended_ = position_ == end_;
+                ended_on_return_ = false;
+            }
+        }
+
+        void resume( Iterator begin, Iterator end )
+        {
+            LALR_ASSERT( ended_ );
+            position_ = begin;
+            end_ = end;
+            ended_ = begin == end;
+            if ( ended_on_return_ && !ended_ && *position_ == '\n' )
+            {
+                --line_;
+            }
+            ended_on_return_ = ended_on_return_ && ended_;
+        }
+
         void skip( Iterator position, int lines )
         {
             LALR_ASSERT( lines >= 0 );
@@ -132,6 +181,7 @@ class PositionIterator
             ended_ = position_ == end_;
             line_ += lines;
             column_ = 1;
+            ended_on_return_ = false;
         }
 };
 
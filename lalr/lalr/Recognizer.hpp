@@ -0,0 +1,74 @@
+#ifndef LALR_RECOGNIZER_HPP_INCLUDED
+#define LALR_RECOGNIZER_HPP_INCLUDED
+
+#include "EventParser.hpp"
+#include "ErrorPolicy.hpp"
+#include <memory>
+#include <string>
+
+namespace lalr
+{
+
+class ParserAction;
+class ParserSymbol;
+class ParserStateMachine;
+
+/**
+// A %parser that only decides whether or not its input is in the language
+// of a grammar.
+//
+// A %Recognizer has no user data and takes no parser actions; it's an 
+// EventParser with a handler whose events compile away, leaving only the 
+// stack of state indices.  Input is rejected at the first error, lexical 
+// or syntactic, without any error recovery and the position of that error
+// is kept to be reported by Recognizer::line() and Recognizer::column().
+*/
+template <class Iterator, class Char = typename std::iterator_traits<Iterator>::value_type, class Traits = typename std::char_traits<Char>, class Allocator = typename std::allocator<Char> >
+class Recognizer
+{
+    public:
+        typedef std::function<void (Iterator begin, Iterator end, std::basic_string<Char, Traits, Allocator>* lexeme, const void** symbol, Iterator* position, int* lines)> LexerActionFunction;
+
+    private:
+        struct NullHandler
+        {
+            void on_shift( const ParserSymbol* /*symbol*/, const Char* /*lexeme_begin*/, const Char* /*lexeme_end*/ ) {}
+            void on_reduce( const ParserSymbol* /*symbol*/, const ParserAction* /*action*/, size_t /*length*/ ) {}
+        };
+
+        class FirstErrorPolicy : public ErrorPolicy
+        {
+            ErrorPolicy* error_policy_; ///< The error policy that errors are forwarded to or null to swallow them.
+            int line_; ///< The line number of the first error or 0 if there hasn't been an error.
+            int column_; ///< The column number of the first error or 0 if there hasn't been an error.
+            int error_; ///< The error code of the first error or PARSER_ERROR_NONE if there hasn't been an error.
+
+            public:
+                FirstErrorPolicy( ErrorPolicy* error_policy );
+                void reset();
+                int line() const;
+                int column() const;
+                int error() const;
+                void lalr_error( int line, int column, int error, const char* format, va_list args );
+                void lalr_vprintf( const char* format, va_list args );
+        };
+
+        NullHandler handler_; ///< The handler that the parser's events are passed to and ignored by.
+        FirstErrorPolicy error_policy_; ///< The error policy that keeps the position of the first error.
+        EventParser<Iterator, NullHandler, Char, Traits, Allocator> parser_; ///< The parser used to recognize input.
+
+    public:
+        Recognizer( const ParserStateMachine* state_machine, ErrorPolicy* error_policy = nullptr );
+        bool recognize( Iterator start, Iterator finish );
+        bool accepted() const;
+        bool full() const;
+        int line() const;
+        int column() const;
+        int error() const;
+        AddLexerActionHandler<Iterator, Char, Traits, Allocator> lexer_action_handlers();
+        void set_lexer_action_handler( const char* identifier, LexerActionFunction function );
+};
+
+}
+
+#endif
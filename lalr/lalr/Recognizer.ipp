@@ -0,0 +1,240 @@
+#ifndef LALR_RECOGNIZER_IPP_INCLUDED
+#define LALR_RECOGNIZER_IPP_INCLUDED
+
+#include "Recognizer.hpp"
+#include "EventParser.ipp"
+#include "ErrorCode.hpp"
+#include "assert.hpp"
+
+namespace lalr
+{
+
+/**
+// Constructor.
+//
+// @param error_policy
+//  The error policy to forward errors to or null to only keep the position
+//  of the first error.
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+Recognizer<Iterator, Char, Traits, Allocator>::FirstErrorPolicy::FirstErrorPolicy( ErrorPolicy* error_policy )
+: error_policy_( error_policy ),
+  line_( 0 ),
+  column_( 0 ),
+  error_( PARSER_ERROR_NONE )
+{
+}
+
+/**
+// Forget the first error in preparation for the next input.
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+void Recognizer<Iterator, Char, Traits, Allocator>::FirstErrorPolicy::reset()
+{
+    line_ = 0;
+    column_ = 0;
+    error_ = PARSER_ERROR_NONE;
+}
+
+/**
+// Get the line number of the first error.
+//
+// @return
+//  The line number or 0 if there hasn't been an error.
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+int Recognizer<Iterator, Char, Traits, Allocator>::FirstErrorPolicy::line() const
+{
+    return line_;
+}
+
+/**
+// Get the column number of the first error.
+//
+// @return
+//  The column number or 0 if there hasn't been an error.
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+int Recognizer<Iterator, Char, Traits, Allocator>::FirstErrorPolicy::column() const
+{
+    return column_;
+}
+
+/**
+// Get the error code of the first error.
+//
+// @return
+//  The error code or PARSER_ERROR_NONE if there hasn't been an error.
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+int Recognizer<Iterator, Char, Traits, Allocator>::FirstErrorPolicy::error() const
+{
+    return error_;
+}
+
+/**
+// Keep the position of the first error and forward it.
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+void Recognizer<Iterator, Char, Traits, Allocator>::FirstErrorPolicy::lalr_error( int line, int column, int error, const char* format, va_list args )
+{
+    if ( error_ == PARSER_ERROR_NONE )
+    {
+        line_ = line;
+        column_ = column;
+        error_ = error;
+    }
+    if ( error_policy_ )
+    {
+        error_policy_->lalr_error( line, column, error, format, args );
+    }
+}
+
+/**
+// Forward debug output.
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+void Recognizer<Iterator, Char, Traits, Allocator>::FirstErrorPolicy::lalr_vprintf( const char* format, va_list args )
+{
+    if ( error_policy_ )
+    {
+        error_policy_->lalr_vprintf( format, args );
+    }
+}
+
+/**
+// Constructor.
+//
+// @param state_machine
+//  The state machine that this %Recognizer will use (assumed not null).
+//
+// @param error_policy
+//  The error policy to report errors to or null to silently swallow 
+//  errors.
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+Recognizer<Iterator, Char, Traits, Allocator>::Recognizer( const ParserStateMachine* state_machine, ErrorPolicy* error_policy )
+: handler_(),
+  error_policy_( error_policy ),
+  parser_( state_machine, &handler_, &error_policy_ )
+{
+    parser_.set_error_recovery_enabled( false );
+}
+
+/**
+// Recognize [\e start, \e finish).
+//
+// @param start
+//  The first character in the sequence to recognize.
+//
+// @param finish
+//  One past the last character in the sequence to recognize.
+//
+// @return
+//  True if all of [\e start, \e finish) is in the language of the grammar
+//  otherwise false.
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+bool Recognizer<Iterator, Char, Traits, Allocator>::recognize( Iterator start, Iterator finish )
+{
+    error_policy_.reset();
+    parser_.parse( start, finish );
+    return parser_.accepted() && parser_.full() && error_policy_.error() == PARSER_ERROR_NONE;
+}
+
+/**
+// Did the most recent call to Recognizer::recognize() accept its input?
+//
+// @return
+//  True if the input was accepted otherwise false.
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+bool Recognizer<Iterator, Char, Traits, Allocator>::accepted() const
+{
+    return parser_.accepted();
+}
+
+/**
+// Did the most recent call to Recognizer::recognize() consume all of its
+// input?
+//
+// @return
+//  True if all of the input was consumed otherwise false.
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+bool Recognizer<Iterator, Char, Traits, Allocator>::full() const
+{
+    return parser_.full();
+}
+
+/**
+// Get the line number of the first error in the most recently recognized
+// input.
+//
+// @return
+//  The line number or 0 if there was no error.
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+int Recognizer<Iterator, Char, Traits, Allocator>::line() const
+{
+    return error_policy_.line();
+}
+
+/**
+// Get the column number of the first error in the most recently 
+// recognized input.
+//
+// @return
+//  The column number or 0 if there was no error.
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+int Recognizer<Iterator, Char, Traits, Allocator>::column() const
+{
+    return error_policy_.column();
+}
+
+/**
+// Get the error code of the first error in the most recently recognized 
+// input.
+//
+// @return
+//  The error code or PARSER_ERROR_NONE if there was no error.
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+int Recognizer<Iterator, Char, Traits, Allocator>::error() const
+{
+    return error_policy_.error();
+}
+
+/**
+// Get an AddLexerActionHandler object that can be used to add lexer action
+// handlers to this %Recognizer.
+//
+// @return
+//  An AddLexerActionHandler.
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+AddLexerActionHandler<Iterator, Char, Traits, Allocator> Recognizer<Iterator, Char, Traits, Allocator>::lexer_action_handlers()
+{
+    return parser_.lexer_action_handlers();
+}
+
+/**
+// Set the handler for a lexer action.
+//
+// @param identifier
+//  The identifier of the lexer action to set the handler for (assumed not
+//  null).
+//
+// @param function
+//  The function to call when the lexer action is taken.
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+void Recognizer<Iterator, Char, Traits, Allocator>::set_lexer_action_handler( const char* identifier, LexerActionFunction function )
+{
+    parser_.set_lexer_action_handler( identifier, function );
+}
+
+}
+
+#endif
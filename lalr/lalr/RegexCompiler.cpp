@@ -8,10 +8,14 @@
 #include "LexerState.hpp"
 #include "LexerTransition.hpp"
 #include "LexerAction.hpp"
+#include "LexerLoop.hpp"
 #include "assert.hpp"
+#include <map>
+#include <algorithm>
 #include <string.h>
 
 using std::set;
+using std::map;
 using std::vector;
 using std::unique_ptr;
 using namespace lalr;
@@ -21,6 +25,9 @@ RegexCompiler::RegexCompiler()
   actions_(),
   transitions_(),
   states_(),
+  character_classes_(),
+  transition_table_(),
+  loops_(),
   state_machine_() 
 {
     state_machine_.reset( new LexerStateMachine );
@@ -46,13 +53,14 @@ void RegexCompiler::compile( const std::string& regular_expression, void* symbol
     }
 }
 
-void RegexCompiler::compile( const std::vector<RegexToken>& tokens, ErrorPolicy* error_policy )
+void RegexCompiler::compile( const std::vector<RegexToken>& tokens, ErrorPolicy* error_policy, const void* skip_symbol )
 {
     RegexGenerator generator;
     int errors = generator.generate( tokens, error_policy );
     if ( errors == 0 )
     {
         populate_lexer_state_machine( generator );
+        state_machine_->skip_symbol = skip_symbol;
     }
 }
 
@@ -84,6 +92,25 @@ void RegexCompiler::set_states( std::unique_ptr<LexerState[]>& states, int state
     state_machine_->start_state = start_state;
 }
 
+void RegexCompiler::set_tables( std::unique_ptr<unsigned char[]>& character_classes, std::unique_ptr<int[]>& transition_table, int classes_size )
+{
+    LALR_ASSERT( character_classes );
+    LALR_ASSERT( transition_table );
+    LALR_ASSERT( classes_size > 0 && classes_size <= 256 );
+    character_classes_ = move( character_classes );
+    transition_table_ = move( transition_table );
+    state_machine_->classes_size = classes_size;
+    state_machine_->character_classes = character_classes_.get();
+    state_machine_->transition_table = transition_table_.get();
+}
+
+void RegexCompiler::set_loops( std::unique_ptr<LexerLoop[]>& loops, int loops_size )
+{
+    loops_ = move( loops );
+    state_machine_->loops_size = loops_size;
+    state_machine_->loops = loops_.get();
+}
+
 void RegexCompiler::populate_lexer_state_machine( const RegexGenerator& generator )
 {
     const vector<unique_ptr<RegexAction>>& source_actions = generator.actions();
@@ -124,6 +151,7 @@ void RegexCompiler::populate_lexer_state_machine( const RegexGenerator& generato
         state->length = int(source_transitions.size());
         state->transitions = &transitions[transition_index];
         state->symbol = source_state->get_symbol();
+        state->loop = nullptr;
         if ( source_state == generator.start_state() )
         {
             start_state = state;
@@ -147,4 +175,124 @@ void RegexCompiler::populate_lexer_state_machine( const RegexGenerator& generato
     set_actions( actions, int(source_actions.size()) );
     set_transitions( transitions, int(transitions_size) );
     set_states( states, int(source_states.size()), start_state );
+    populate_tables();
+    populate_loops();
+}
+
+void RegexCompiler::populate_tables()
+{
+    // Characters in [0, 256) that take the same transition from every state
+    // are equivalent and share a column in the transition table so that the
+    // lexer can find the transition on those characters with an indexed 
+    // load rather than by searching.  Characters outside that range are 
+    // still found by searching each state's transitions.
+    const int CHARACTERS = 256;
+    const LexerStateMachine* state_machine = state_machine_.get();
+    int states_size = state_machine->states_size;
+    unique_ptr<unsigned char[]> character_classes( new unsigned char [CHARACTERS] );
+    map<vector<int>, int> classes;
+    vector<vector<int>> columns;
+    vector<int> column( states_size );
+    for ( int character = 0; character < CHARACTERS; ++character )
+    {
+        for ( int i = 0; i < states_size; ++i )
+        {
+            const LexerState* state = &state_machine->states[i];
+            const LexerTransition* transition = state->transitions;
+            const LexerTransition* transitions_end = state->transitions + state->length;
+            while ( transition != transitions_end && !(character >= transition->begin && character < transition->end) )
+            {
+                ++transition;
+            }
+            column[i] = transition != transitions_end ? int(transition - state_machine->transitions) : int(LexerTransition::INVALID_INDEX);
+        }
+
+        auto inserted = classes.insert( make_pair(column, int(columns.size())) );
+        if ( inserted.second )
+        {
+            columns.push_back( column );
+        }
+        character_classes[character] = (unsigned char) inserted.first->second;
+    }
+
+    int classes_size = int(columns.size());
+    unique_ptr<int[]> transition_table( new int [states_size * classes_size] );
+    for ( int i = 0; i < states_size; ++i )
+    {
+        for ( int j = 0; j < classes_size; ++j )
+        {
+            transition_table[i * classes_size + j] = columns[j][i];
+        }
+    }
+
+    set_tables( character_classes, transition_table, classes_size );
+}
+
+void RegexCompiler::populate_loops()
+{
+    // States that transition back to themselves, without an action, on 
+    // more characters than they transition anywhere else on spend most of 
+    // their time looping (e.g. in the middle of identifiers, numbers, and 
+    // whitespace).  The characters of each such loop are recorded as a bit
+    // set and, when they fit, as a few ranges so that the lexer can skip 
+    // over runs of them without a transition lookup per character.
+    const int CHARACTERS = LexerLoop::CHARACTERS;
+    int states_size = state_machine_->states_size;
+    unique_ptr<LexerLoop[]> loops( new LexerLoop [states_size] );
+    memset( loops.get(), 0, sizeof(LexerLoop) * states_size );
+    int loops_size = 0;
+    for ( int i = 0; i < states_size; ++i )
+    {
+        LexerState* state = &states_[i];
+        LexerLoop* loop = &loops[loops_size];
+        vector<std::pair<int, int>> ranges;
+        int looping = 0;
+        int leaving = 0;
+        const LexerTransition* transitions_end = state->transitions + state->length;
+        for ( const LexerTransition* transition = state->transitions; transition != transitions_end; ++transition )
+        {
+            int begin = std::max( transition->begin, 0 );
+            int end = std::min( transition->end, CHARACTERS );
+            if ( begin < end && transition->state == state && !transition->action )
+            {
+                looping += end - begin;
+                for ( int character = begin; character < end; ++character )
+                {
+                    loop->characters[character / 8] |= (unsigned char) (1 << (character % 8));
+                }
+                if ( !ranges.empty() && ranges.back().second == begin )
+                {
+                    ranges.back().second = end;
+                }
+                else
+                {
+                    ranges.push_back( std::make_pair(begin, end) );
+                }
+            }
+            else if ( begin < end )
+            {
+                leaving += end - begin;
+            }
+        }
+
+        if ( looping > leaving )
+        {
+            if ( ranges.size() <= size_t(LexerLoop::RANGES) )
+            {
+                loop->ranges_size = int(ranges.size());
+                for ( size_t j = 0; j < ranges.size(); ++j )
+                {
+                    loop->ranges[j * 2] = (unsigned char) ranges[j].first;
+                    loop->ranges[j * 2 + 1] = (unsigned char) (ranges[j].second - 1);
+                }
+            }
+            state->loop = loop;
+            ++loops_size;
+        }
+        else
+        {
+            memset( loop, 0, sizeof(*loop) );
+        }
+    }
+    set_loops( loops, loops_size );
 }
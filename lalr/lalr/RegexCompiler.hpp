@@ -14,6 +14,7 @@ class ErrorPolicy;
 class LexerAction;
 class LexerTransition;
 class LexerState;
+class LexerLoop;
 class LexerStateMachine;
 class RegexGenerator;
 
@@ -26,6 +27,9 @@ class RegexCompiler
     std::unique_ptr<LexerAction[]> actions_;
     std::unique_ptr<LexerTransition[]> transitions_;
     std::unique_ptr<LexerState[]> states_;
+    std::unique_ptr<unsigned char[]> character_classes_;
+    std::unique_ptr<int[]> transition_table_;
+    std::unique_ptr<LexerLoop[]> loops_;
     std::unique_ptr<LexerStateMachine> state_machine_; 
 
 public:
@@ -33,12 +37,16 @@ public:
     ~RegexCompiler();
     const LexerStateMachine* state_machine() const;
     void compile( const std::string& regular_expression, void* symbol, ErrorPolicy* error_policy = nullptr );
-    void compile( const std::vector<RegexToken>& tokens, ErrorPolicy* error_policy = nullptr );
+    void compile( const std::vector<RegexToken>& tokens, ErrorPolicy* error_policy = nullptr, const void* skip_symbol = nullptr );
     const char* add_string( const std::string& string );
     void set_actions( std::unique_ptr<LexerAction[]>& actions, int actions_size );
     void set_transitions( std::unique_ptr<LexerTransition[]>& transitions, int transitions_size );
     void set_states( std::unique_ptr<LexerState[]>& states, int states_size, const LexerState* start_state );
+    void set_tables( std::unique_ptr<unsigned char[]>& character_classes, std::unique_ptr<int[]>& transition_table, int classes_size );
+    void set_loops( std::unique_ptr<LexerLoop[]>& loops, int loops_size );
     void populate_lexer_state_machine( const RegexGenerator& generator );
+    void populate_tables();
+    void populate_loops();
 };
 
 }
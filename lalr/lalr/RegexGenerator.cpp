@@ -12,19 +12,26 @@
 #include "LexerAction.hpp"
 #include "RegexItem.hpp"
 #include "RegexState.hpp"
+#include "RegexTransition.hpp"
 #include "RegexAction.hpp"
 #include "RegexNode.hpp"
 #include "RegexSyntaxTree.hpp"
 #include "RegexParser.hpp"
 #include "ErrorPolicy.hpp"
 #include "assert.hpp"
+#include <algorithm>
+#include <map>
 #include <limits.h>
 
 using std::set;
+using std::map;
 using std::pair;
 using std::vector;
 using std::make_pair;
 using std::unique_ptr;
+using std::sort;
+using std::unique;
+using std::lower_bound;
 using namespace lalr;
 
 /**
@@ -306,11 +313,230 @@ void RegexGenerator::generate_states( const RegexSyntaxTree& syntax_tree, std::s
                 }
             }
         }
+
+        minimize_states();
     }
 
     generate_indices_for_states();
 }
 
+/**
+// Merge equivalent states using Hopcroft's partition refinement algorithm.
+//
+// Two states are equivalent when they recognize the same symbol and, on 
+// every character, take the same action and transition to equivalent 
+// states.  The characters are split into the elementary intervals bounded
+// by the transitions of all states and missing transitions are made to an 
+// explicit sink state that is never merged with any other state so that 
+// the lexer still stops in exactly the same places.
+*/
+void RegexGenerator::minimize_states()
+{
+    if ( states_.empty() )
+    {
+        return;
+    }
+
+    // Index the states (the sink state is the last index) and find the 
+    // elementary intervals that all transitions are made up of.
+    vector<RegexState*> states;
+    vector<int> boundaries;
+    for ( auto i = states_.begin(); i != states_.end(); ++i )
+    {
+        RegexState* state = i->get();
+        LALR_ASSERT( state );
+        state->set_index( int(states.size()) );
+        states.push_back( state );
+        const set<RegexTransition>& transitions = state->get_transitions();
+        for ( auto j = transitions.begin(); j != transitions.end(); ++j )
+        {
+            boundaries.push_back( j->begin() );
+            boundaries.push_back( j->end() );
+        }
+    }
+    sort( boundaries.begin(), boundaries.end() );
+    boundaries.erase( unique(boundaries.begin(), boundaries.end()), boundaries.end() );
+
+    int states_size = int(states.size());
+    int sink = states_size;
+    int intervals_size = boundaries.empty() ? 0 : int(boundaries.size()) - 1;
+    vector<int> targets( (states_size + 1) * intervals_size, sink );
+    vector<const RegexAction*> actions( (states_size + 1) * intervals_size, nullptr );
+    for ( int i = 0; i < states_size; ++i )
+    {
+        const set<RegexTransition>& transitions = states[i]->get_transitions();
+        for ( auto j = transitions.begin(); j != transitions.end(); ++j )
+        {
+            int interval = int(lower_bound(boundaries.begin(), boundaries.end(), j->begin()) - boundaries.begin());
+            while ( interval < intervals_size && boundaries[interval] < j->end() )
+            {
+                targets[i * intervals_size + interval] = j->state()->get_index();
+                actions[i * intervals_size + interval] = j->action();
+                ++interval;
+            }
+        }
+    }
+
+    // Partition the states by symbol and the actions taken on each interval
+    // with the sink state in a block of its own.
+    vector<int> block_of_state( states_size + 1 );
+    vector<vector<int>> blocks;
+    map<pair<const void*, vector<const RegexAction*>>, int> initial_blocks;
+    for ( int i = 0; i < states_size; ++i )
+    {
+        vector<const RegexAction*> state_actions( actions.begin() + i * intervals_size, actions.begin() + (i + 1) * intervals_size );
+        auto inserted = initial_blocks.insert( make_pair(make_pair(states[i]->get_symbol(), state_actions), int(blocks.size())) );
+        if ( inserted.second )
+        {
+            blocks.push_back( vector<int>() );
+        }
+        block_of_state[i] = inserted.first->second;
+        blocks[block_of_state[i]].push_back( i );
+    }
+    block_of_state[sink] = int(blocks.size());
+    blocks.push_back( vector<int>(1, sink) );
+
+    // Find the states that transition to each state on each interval.
+    vector<vector<int>> predecessors( (states_size + 1) * intervals_size );
+    for ( int i = 0; i <= states_size; ++i )
+    {
+        for ( int interval = 0; interval < intervals_size; ++interval )
+        {
+            int target = i < states_size ? targets[i * intervals_size + interval] : sink;
+            predecessors[target * intervals_size + interval].push_back( i );
+        }
+    }
+
+    // Split blocks by the states that transition into each splitter block
+    // on each interval until no more blocks can be split.
+    vector<int> worklist;
+    vector<bool> in_worklist( blocks.size(), true );
+    for ( int i = 0; i < int(blocks.size()); ++i )
+    {
+        worklist.push_back( i );
+    }
+    vector<bool> marked( states_size + 1, false );
+    vector<int> marked_counts;
+    while ( !worklist.empty() )
+    {
+        int splitter = worklist.back();
+        worklist.pop_back();
+        in_worklist[splitter] = false;
+        vector<int> splitter_states = blocks[splitter];
+        for ( int interval = 0; interval < intervals_size; ++interval )
+        {
+            vector<int> touched_blocks;
+            marked_counts.assign( blocks.size(), 0 );
+            for ( auto i = splitter_states.begin(); i != splitter_states.end(); ++i )
+            {
+                const vector<int>& sources = predecessors[*i * intervals_size + interval];
+                for ( auto j = sources.begin(); j != sources.end(); ++j )
+                {
+                    int block = block_of_state[*j];
+                    if ( marked_counts[block] == 0 )
+                    {
+                        touched_blocks.push_back( block );
+                    }
+                    marked[*j] = true;
+                    ++marked_counts[block];
+                }
+            }
+
+            for ( auto i = touched_blocks.begin(); i != touched_blocks.end(); ++i )
+            {
+                int block = *i;
+                if ( marked_counts[block] < int(blocks[block].size()) )
+                {
+                    vector<int> inside;
+                    vector<int> outside;
+                    for ( auto j = blocks[block].begin(); j != blocks[block].end(); ++j )
+                    {
+                        (marked[*j] ? inside : outside).push_back( *j );
+                    }
+                    int new_block = int(blocks.size());
+                    blocks[block].swap( outside );
+                    blocks.push_back( inside );
+                    for ( auto j = blocks[new_block].begin(); j != blocks[new_block].end(); ++j )
+                    {
+                        block_of_state[*j] = new_block;
+                    }
+                    in_worklist.push_back( false );
+                    int smaller_block = blocks[new_block].size() <= blocks[block].size() ? new_block : block;
+                    int added_block = in_worklist[block] ? new_block : smaller_block;
+                    worklist.push_back( added_block );
+                    in_worklist[added_block] = true;
+                }
+            }
+
+            for ( auto i = splitter_states.begin(); i != splitter_states.end(); ++i )
+            {
+                const vector<int>& sources = predecessors[*i * intervals_size + interval];
+                for ( auto j = sources.begin(); j != sources.end(); ++j )
+                {
+                    marked[*j] = false;
+                }
+            }
+        }
+    }
+
+    // Keep the first state in each block, redirect transitions to the kept
+    // states merging adjacent intervals that now lead to the same place, 
+    // and remove the states that have been merged away.
+    vector<RegexState*> representatives( blocks.size(), nullptr );
+    for ( int i = 0; i < states_size; ++i )
+    {
+        int block = block_of_state[i];
+        if ( !representatives[block] )
+        {
+            representatives[block] = states[i];
+        }
+    }
+
+    for ( int i = 0; i < states_size; ++i )
+    {
+        RegexState* state = states[i];
+        if ( representatives[block_of_state[i]] == state )
+        {
+            const int* state_targets = &targets[i * intervals_size];
+            const RegexAction* const* state_actions = &actions[i * intervals_size];
+            set<RegexTransition> transitions;
+            int interval = 0;
+            while ( interval < intervals_size )
+            {
+                int begin = interval;
+                int target = state_targets[begin];
+                ++interval;
+                if ( target != sink )
+                {
+                    while ( interval < intervals_size && state_targets[interval] != sink && block_of_state[state_targets[interval]] == block_of_state[target] && state_actions[interval] == state_actions[begin] )
+                    {
+                        ++interval;
+                    }
+                    transitions.insert( RegexTransition(boundaries[begin], boundaries[interval], representatives[block_of_state[target]], state_actions[begin]) );
+                }
+            }
+            state->set_transitions( transitions );
+        }
+    }
+
+    start_state_ = representatives[block_of_state[start_state_->get_index()]];
+    auto i = states_.begin();
+    while ( i != states_.end() )
+    {
+        const RegexState* state = i->get();
+        if ( representatives[block_of_state[state->get_index()]] != state )
+        {
+            i = states_.erase( i );
+        }
+        else
+        {
+            ++i;
+        }
+    }
+
+    fire_printf( "Minimized %d lexer states to %d\n", states_size, int(states_.size()) );
+}
+
 /**
 // Generate indices for the generated states.
 */
@@ -50,6 +50,7 @@ class RegexGenerator
     private:
         std::unique_ptr<RegexState> goto_( const RegexState* state, int begin, int end );
         void generate_states( const RegexSyntaxTree& syntax_tree, std::set<std::unique_ptr<RegexState>, RegexStateLess>* states, const RegexState** start_state );
+        void minimize_states();
         void generate_indices_for_states();
         void generate_symbol_for_state( RegexState* state ) const;
         void clear();
@@ -6,6 +6,7 @@
 #include "RegexItem.hpp"
 #include "RegexNode.hpp"
 #include "assert.hpp"
+#include <algorithm>
 #include <string>
 
 using namespace lalr;
@@ -147,11 +148,15 @@ const RegexAction* RegexItem::find_action_by_interval( int begin, int end ) cons
 /**
 // Less than operator.
 //
+// Nodes are compared by type and index rather than by address so that 
+// the order of items, and so the states of the generated state machine, 
+// doesn't depend on where nodes happen to be allocated.
+//
 // @return
 //  True if the next nodes of this item are less than the next nodes of 
 //  \e item.
 */
 bool RegexItem::operator<( const RegexItem& item ) const
 {
-    return next_nodes_ < item.next_nodes_;
+    return std::lexicographical_compare( next_nodes_.begin(), next_nodes_.end(), item.next_nodes_.begin(), item.next_nodes_.end(), RegexNodeLess() );
 }
@@ -161,6 +161,17 @@ void RegexState::add_transition( int begin, int end, RegexState* state )
     (void) inserted;
 }
 
+/**
+// Replace the transitions from this state with \e transitions.
+//
+// @param transitions
+//  The transitions to make from this state.
+*/
+void RegexState::set_transitions( const std::set<RegexTransition>& transitions )
+{
+    transitions_ = transitions;
+}
+
 /**
 // Set the symbol that this state matches.
 //
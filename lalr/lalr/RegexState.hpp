@@ -33,6 +33,7 @@ class RegexState
         bool operator<( const RegexState& state ) const;
         int add_item( const std::set<RegexNode*, RegexNodeLess>& next_nodes );
         void add_transition( int begin, int end, RegexState* state );
+        void set_transitions( const std::set<RegexTransition>& transitions );
         void set_symbol( const void* symbol );
         void set_processed( bool processed );
         void set_index( int index );
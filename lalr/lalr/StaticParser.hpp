@@ -0,0 +1,47 @@
+#ifndef LALR_STATICPARSER_HPP_INCLUDED
+#define LALR_STATICPARSER_HPP_INCLUDED
+
+#include "Parser.hpp"
+
+namespace lalr
+{
+
+/**
+// A %Parser whose parser actions are member functions of a handler class
+// dispatched through a `switch` generated by lalrc.
+//
+// Running lalrc with `--actions HEADER` writes a header declaring an 
+// `enum class` of the grammar's action indices and an \e Actions class 
+// whose static `reduce()` function switches on the action being taken and
+// calls the handler member function with the same name as the action, 
+// e.g. `handler->document( data, nodes, length )` for `[document]`.  The
+// calls are made on the concrete \e Handler type so they can be inlined 
+// into the `switch` and a handler without a member function for one of the
+// grammar's actions fails to compile rather than silently returning 
+// `UserData()`.
+//
+// Reductions without an action still go to the default action handler, if
+// there is one, and otherwise return `UserData()`.
+*/
+template <class Iterator, class Handler, class Actions, class UserData = std::shared_ptr<ParserUserData<typename std::iterator_traits<Iterator>::value_type> >, class Char = typename std::iterator_traits<Iterator>::value_type, class Traits = typename std::char_traits<Char>, class Allocator = typename std::allocator<Char> >
+class StaticParser : public Parser<Iterator, UserData, Char, Traits, Allocator>
+{
+    public:
+        typedef typename Parser<Iterator, UserData, Char, Traits, Allocator>::ParserNode ParserNode;
+
+    private:
+        Handler* handler_; ///< The handler whose member functions are called for parser actions.
+
+    public:
+        StaticParser( const ParserStateMachine* state_machine, Handler* handler, ErrorPolicy* error_policy = nullptr );
+        Handler* handler() const;
+
+    private:
+        static UserData dispatch( void* context, int action, UserData* data, const ParserNode* nodes, size_t length );
+};
+
+}
+
+#include "StaticParser.ipp"
+
+#endif
@@ -0,0 +1,75 @@
+#ifndef LALR_STATICPARSER_IPP_INCLUDED
+#define LALR_STATICPARSER_IPP_INCLUDED
+
+#include "StaticParser.hpp"
+#include "assert.hpp"
+
+namespace lalr
+{
+
+/**
+// Constructor.
+//
+// @param state_machine
+//  The state machine and actions that this %StaticParser will use (assumed
+//  not null).
+//
+// @param handler
+//  The handler to call parser actions on (assumed not null).
+//
+// @param error_policy
+//  The error policy to notifiy errors from the lexer to or null to silently
+//  swallow lexical errors.
+*/
+template <class Iterator, class Handler, class Actions, class UserData, class Char, class Traits, class Allocator>
+StaticParser<Iterator, Handler, Actions, UserData, Char, Traits, Allocator>::StaticParser( const ParserStateMachine* state_machine, Handler* handler, ErrorPolicy* error_policy )
+: Parser<Iterator, UserData, Char, Traits, Allocator>( state_machine, error_policy ),
+  handler_( handler )
+{
+    LALR_ASSERT( handler_ );
+    this->set_action_dispatch( &StaticParser::dispatch, handler_ );
+}
+
+/**
+// Get the handler that parser actions are called on.
+//
+// @return
+//  The handler.
+*/
+template <class Iterator, class Handler, class Actions, class UserData, class Char, class Traits, class Allocator>
+Handler* StaticParser<Iterator, Handler, Actions, UserData, Char, Traits, Allocator>::handler() const
+{
+    return handler_;
+}
+
+/**
+// Dispatch \e action to the handler passed as \e context.
+//
+// @param context
+//  The handler to call the parser action on.
+//
+// @param action
+//  The index of the parser action being taken.
+//
+// @param data
+//  The user data of the symbols being reduced.
+//
+// @param nodes
+//  The nodes of the symbols being reduced.
+//
+// @param length
+//  The number of symbols being reduced.
+//
+// @return
+//  The user data that results from the reduction.
+*/
+template <class Iterator, class Handler, class Actions, class UserData, class Char, class Traits, class Allocator>
+UserData StaticParser<Iterator, Handler, Actions, UserData, Char, Traits, Allocator>::dispatch( void* context, int action, UserData* data, const ParserNode* nodes, size_t length )
+{
+    LALR_ASSERT( context );
+    return Actions::template reduce<UserData>( static_cast<Handler*>(context), action, data, nodes, length );
+}
+
+}
+
+#endif
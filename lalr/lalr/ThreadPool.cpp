@@ -0,0 +1,149 @@
+//
+// ThreadPool.cpp
+// Copyright (c) Charles Baker. All rights reserved.
+//
+
+#include "ThreadPool.hpp"
+#include "assert.hpp"
+
+using std::unique_lock;
+using std::mutex;
+using namespace lalr;
+
+/**
+// Constructor.
+//
+// @param threads
+//  The number of threads to start (assumed >= 0).
+*/
+ThreadPool::ThreadPool( int threads )
+: threads_(),
+  tasks_(),
+  mutex_(),
+  tasks_pushed_(),
+  tasks_finished_(),
+  running_( 0 ),
+  stopping_( false )
+{
+    LALR_ASSERT( threads >= 0 );
+    threads_.reserve( threads );
+    for ( int i = 0; i < threads; ++i )
+    {
+        threads_.push_back( std::thread(&ThreadPool::run, this) );
+    }
+}
+
+/**
+// Destructor.
+//
+// Waits for queued tasks to finish and then stops and joins the threads.
+*/
+ThreadPool::~ThreadPool()
+{
+    wait();
+    {
+        unique_lock<mutex> lock( mutex_ );
+        stopping_ = true;
+    }
+    tasks_pushed_.notify_all();
+    for ( std::vector<std::thread>::iterator i = threads_.begin(); i != threads_.end(); ++i )
+    {
+        i->join();
+    }
+}
+
+/**
+// Get the number of threads in this pool.
+//
+// @return
+//  The number of threads.
+*/
+int ThreadPool::threads() const
+{
+    return int(threads_.size());
+}
+
+/**
+// Queue \e task to be run by the next available thread.
+//
+// @param task
+//  The task to run.
+*/
+void ThreadPool::push( std::function<void ()> task )
+{
+    LALR_ASSERT( task );
+    {
+        unique_lock<mutex> lock( mutex_ );
+        tasks_.push_back( std::move(task) );
+    }
+    tasks_pushed_.notify_one();
+}
+
+/**
+// Run queued tasks on the calling thread until the queue is empty and then
+// wait for the tasks running on other threads to finish.
+*/
+void ThreadPool::wait()
+{
+    unique_lock<mutex> lock( mutex_ );
+    while ( !tasks_.empty() || running_ > 0 )
+    {
+        if ( !tasks_.empty() )
+        {
+            std::function<void ()> task = std::move( tasks_.front() );
+            tasks_.pop_front();
+            ++running_;
+            lock.unlock();
+            task();
+            lock.lock();
+            --running_;
+        }
+        else
+        {
+            tasks_finished_.wait( lock );
+        }
+    }
+}
+
+/**
+// Get the number of threads that the hardware can run concurrently.
+//
+// @return
+//  The number of hardware threads or 1 if that isn't known.
+*/
+int ThreadPool::hardware_threads()
+{
+    unsigned int threads = std::thread::hardware_concurrency();
+    return threads > 0 ? int(threads) : 1;
+}
+
+/**
+// Run queued tasks until this pool is stopped.
+*/
+void ThreadPool::run()
+{
+    unique_lock<mutex> lock( mutex_ );
+    for ( ;; )
+    {
+        while ( tasks_.empty() && !stopping_ )
+        {
+            tasks_pushed_.wait( lock );
+        }
+        if ( tasks_.empty() )
+        {
+            break;
+        }
+
+        std::function<void ()> task = std::move( tasks_.front() );
+        tasks_.pop_front();
+        ++running_;
+        lock.unlock();
+        task();
+        lock.lock();
+        --running_;
+        if ( running_ == 0 && tasks_.empty() )
+        {
+            tasks_finished_.notify_all();
+        }
+    }
+}
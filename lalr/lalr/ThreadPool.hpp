@@ -0,0 +1,47 @@
+#ifndef LALR_THREADPOOL_HPP_INCLUDED
+#define LALR_THREADPOOL_HPP_INCLUDED
+
+#include <deque>
+#include <vector>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace lalr
+{
+
+/**
+// @internal
+//
+// A fixed number of threads that run tasks pushed to a shared queue.
+//
+// The thread that waits for the queued tasks to finish runs queued tasks
+// itself while it waits so a pool with no threads runs every task on the
+// waiting thread.
+*/
+class ThreadPool
+{
+    std::vector<std::thread> threads_; ///< The threads that run tasks.
+    std::deque<std::function<void ()>> tasks_; ///< The tasks that are waiting to run.
+    std::mutex mutex_; ///< Guards tasks_, running_, and stopping_.
+    std::condition_variable tasks_pushed_; ///< Notified when tasks are pushed or the pool is stopping.
+    std::condition_variable tasks_finished_; ///< Notified when the last running task finishes.
+    int running_; ///< The number of tasks that are running.
+    bool stopping_; ///< True when the threads should exit otherwise false.
+
+public:
+    ThreadPool( int threads );
+    ~ThreadPool();
+    int threads() const;
+    void push( std::function<void ()> task );
+    void wait();
+    static int hardware_threads();
+
+private:
+    void run();
+};
+
+}
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef LALR_SIMD_HPP_INCLUDED
+#define LALR_SIMD_HPP_INCLUDED
+
+// Define LALR_LEXER_SIMD to 0 to scan input one character at a time rather
+// than sixteen at a time with SSE2.
+#ifndef LALR_LEXER_SIMD
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define LALR_LEXER_SIMD 1
+#else
+#define LALR_LEXER_SIMD 0
+#endif
+#endif
+
+#if LALR_LEXER_SIMD
+#include <emmintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace lalr
+{
+
+/**
+// Count the trailing zero bits in \e mask (assumed not zero).
+*/
+inline int count_trailing_zeros( unsigned int mask )
+{
+#if defined(_MSC_VER)
+    unsigned long index = 0;
+    _BitScanForward( &index, mask );
+    return int(index);
+#else
+    return __builtin_ctz( mask );
+#endif
+}
+
+}
+#endif
+
+#endif
@@ -0,0 +1,142 @@
+#include <lalr/BatchParser.ipp>
+#include <lalr/GrammarCompiler.hpp>
+#include <lalr/assert.hpp>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <algorithm>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+using namespace std;
+using namespace lalr;
+
+static const char* json_grammar =
+    "json {\n"
+    "   %whitespace \"[ \\t\\r\\n]*\";\n"
+    "   document: '{' element '}' [document];\n"
+    "   element: name ':' '{' contents '}' [element];\n"
+    "   contents: contents ',' content [add_to_element] | content [create_element];\n"
+    "   content: attribute [content] | element [content];\n"
+    "   attribute: name ':' value [attribute];\n"
+    "   value: 'null' [value] | 'true' [value] | 'false' [value] | integer [value] | real [value] | string [value];\n"
+    "   name: \"[\\\"']:string:\";\n"
+    "   integer: \"(\\+|\\-)?[0-9]+\";\n"
+    "   real: \"(\\+|\\-)?[0-9]+(\\.[0-9]+)?((e|E)(\\+|\\-)?[0-9]+)?\";\n"
+    "   string: \"[\\\"']:string:\";\n"
+    "}\n"
+;
+
+static void string_( const char* begin, const char* end, std::string* lexeme, const void** /*symbol*/, const char** position, int* lines )
+{
+    LALR_ASSERT( lexeme );
+    LALR_ASSERT( lexeme->length() == 1 );
+    int terminator = lexeme->at( 0 );
+    const char* i = begin;
+    while ( i != end && *i != terminator )
+    {
+        ++i;
+    }
+    lexeme->assign( begin, i );
+    *position = i != end ? i + 1 : i;
+    *lines = 0;
+}
+
+static void bind_json_handlers( Parser<const char*, int>* parser )
+{
+    parser->set_lexer_action_handler( "string", &string_ );
+    parser->parser_action_handlers()
+        ( "document", [] ( const int* data, const ParserNode<>* /*nodes*/, size_t /*length*/ ) { return data[1]; } )
+        ( "element", [] ( const int* data, const ParserNode<>* /*nodes*/, size_t /*length*/ ) { return data[3]; } )
+        ( "attribute", [] ( const int* /*data*/, const ParserNode<>* /*nodes*/, size_t /*length*/ ) { return 1; } )
+        ( "value", [] ( const int* /*data*/, const ParserNode<>* /*nodes*/, size_t /*length*/ ) { return 1; } )
+        ( "add_to_element", [] ( const int* data, const ParserNode<>* /*nodes*/, size_t /*length*/ ) { return data[0] + data[2]; } )
+        ( "create_element", [] ( const int* data, const ParserNode<>* /*nodes*/, size_t /*length*/ ) { return data[0]; } )
+        ( "content", [] ( const int* data, const ParserNode<>* /*nodes*/, size_t /*length*/ ) { return data[0]; } )
+    ;
+}
+
+static void generate_element( std::string* json, int depth, int seed )
+{
+    char attribute [128];
+    *json += "\"element\": {\n";
+    for ( int i = 0; i < 8; ++i )
+    {
+        snprintf( attribute, sizeof(attribute), "    \"name%d\": \"value %d\",\n    \"integer%d\": %d,\n    \"real%d\": %d.5e3,\n", i, seed + i, i, seed * i, i, seed );
+        *json += attribute;
+    }
+    *json += "    \"flag\": true";
+    if ( depth > 0 )
+    {
+        for ( int i = 0; i < 3; ++i )
+        {
+            *json += ",\n";
+            generate_element( json, depth - 1, seed + i );
+        }
+    }
+    *json += "\n}";
+}
+
+int lalr_batch_parser_benchmark()
+{
+    // Failures are checked without assertions so that a broken parse is 
+    // never reported as throughput in builds with assertions compiled out.
+    GrammarCompiler compiler;
+    int errors = compiler.compile( json_grammar, json_grammar + strlen(json_grammar) );
+    if ( errors != 0 )
+    {
+        fprintf( stderr, "Compiling the JSON grammar failed with %d errors\n", errors );
+        return EXIT_FAILURE;
+    }
+
+    const int DOCUMENTS = 512;
+    vector<string> inputs( DOCUMENTS );
+    vector<BatchParser<const char*, int>::Document> documents;
+    size_t bytes = 0;
+    for ( int i = 0; i < DOCUMENTS; ++i )
+    {
+        inputs[i] = "{\n";
+        generate_element( &inputs[i], 3 + i % 2, i );
+        inputs[i] += "\n}\n";
+        documents.push_back( make_pair(inputs[i].c_str(), inputs[i].c_str() + inputs[i].size()) );
+        bytes += inputs[i].size();
+    }
+
+    printf( "BatchParser on %d JSON documents (%.1f MB)\n", DOCUMENTS, double(bytes) / (1024.0 * 1024.0) );
+    printf( "threads  seconds     MB/s  speedup\n" );
+
+    int hardware_threads = max( int(thread::hardware_concurrency()), 1 );
+    double baseline = 0.0;
+    for ( int threads = 1; threads <= hardware_threads; threads = threads < hardware_threads ? min(threads * 2, hardware_threads) : threads + 1 )
+    {
+        BatchParser<const char*, int> batch_parser( compiler.parser_state_machine(), &bind_json_handlers, threads );
+        double best = 0.0;
+        for ( int repeat = 0; repeat < 5; ++repeat )
+        {
+            chrono::steady_clock::time_point start = chrono::steady_clock::now();
+            batch_parser.parse( documents );
+            double seconds = chrono::duration<double>( chrono::steady_clock::now() - start ).count();
+            best = repeat == 0 ? seconds : min( best, seconds );
+        }
+
+        int failed = 0;
+        for ( size_t i = 0; i < batch_parser.size(); ++i )
+        {
+            if ( !batch_parser.accepted(i) || !batch_parser.full(i) )
+            {
+                ++failed;
+            }
+        }
+        if ( failed != 0 || batch_parser.size() != documents.size() )
+        {
+            fprintf( stderr, "%d of %d documents failed to parse on %d threads\n", failed + int(documents.size() - batch_parser.size()), DOCUMENTS, threads );
+            return EXIT_FAILURE;
+        }
+
+        baseline = threads == 1 ? best : baseline;
+        printf( "%7d  %7.4f  %7.1f  %7.2f\n", threads, best, double(bytes) / (1024.0 * 1024.0) / best, baseline / best );
+    }
+    return EXIT_SUCCESS;
+}
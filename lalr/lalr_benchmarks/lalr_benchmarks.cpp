@@ -0,0 +1,6 @@
+
+int main()
+{
+    extern int lalr_batch_parser_benchmark();
+    return lalr_batch_parser_benchmark();
+}
@@ -7,6 +7,7 @@
 #include <lalr/LexerStateMachine.hpp>
 #include <lalr/LexerState.hpp>
 #include <lalr/LexerTransition.hpp>
+#include <lalr/LexerLoop.hpp>
 #include <lalr/LexerAction.hpp>
 
 using namespace lalr;
@@ -24,6 +25,13 @@ extern const ParserAction actions [];
 extern const ParserSymbol symbols [];
 extern const ParserTransition transitions [];
 extern const ParserState states [];
+extern const int action_table [];
+extern const int goto_table [];
+extern const int default_table [];
+extern const int base_table [];
+extern const int next_table [];
+extern const int check_table [];
+extern const ParserStateMachine parser_state_machine;
 
 const ParserAction actions [] = 
 {
@@ -62,141 +70,195 @@ const ParserTransition transitions [] =
 {
     {&symbols[1], nullptr, &symbols[9], 0, 2, -1, (TransitionType) 1, 0},
     {&symbols[2], nullptr, &symbols[9], 0, 2, -1, (TransitionType) 1, 1},
-    {&symbols[3], &states[13], nullptr, 0, 0, -1, (TransitionType) 0, 2},
-    {&symbols[9], &states[1], nullptr, 0, 0, -1, (TransitionType) 0, 3},
-    {&symbols[10], &states[3], nullptr, 0, 0, -1, (TransitionType) 0, 4},
-    {&symbols[11], &states[4], nullptr, 0, 0, -1, (TransitionType) 0, 5},
-    {&symbols[13], &states[21], nullptr, 0, 0, -1, (TransitionType) 0, 6},
-    {&symbols[1], nullptr, &symbols[0], 1, 0, -1, (TransitionType) 1, 7},
-    {&symbols[2], &states[6], nullptr, 0, 0, -1, (TransitionType) 0, 8},
-    {&symbols[3], &states[13], nullptr, 0, 0, -1, (TransitionType) 0, 9},
-    {&symbols[10], &states[2], nullptr, 0, 0, -1, (TransitionType) 0, 10},
-    {&symbols[11], &states[4], nullptr, 0, 0, -1, (TransitionType) 0, 11},
-    {&symbols[13], &states[21], nullptr, 0, 0, -1, (TransitionType) 0, 12},
-    {&symbols[1], nullptr, &symbols[9], 2, 0, -1, (TransitionType) 1, 13},
-    {&symbols[2], nullptr, &symbols[9], 2, 0, -1, (TransitionType) 1, 14},
-    {&symbols[3], nullptr, &symbols[9], 2, 0, -1, (TransitionType) 1, 15},
-    {&symbols[13], nullptr, &symbols[9], 2, 0, -1, (TransitionType) 1, 16},
+    {&symbols[3], &states[2], nullptr, 0, 0, -1, (TransitionType) 0, 2},
+    {&symbols[9], &states[3], nullptr, 0, 0, -1, (TransitionType) 0, 3},
+    {&symbols[10], &states[4], nullptr, 0, 0, -1, (TransitionType) 0, 4},
+    {&symbols[11], &states[5], nullptr, 0, 0, -1, (TransitionType) 0, 5},
+    {&symbols[13], &states[6], nullptr, 0, 0, -1, (TransitionType) 0, 6},
+    {&symbols[12], &states[7], nullptr, 0, 0, -1, (TransitionType) 0, 7},
+    {&symbols[3], &states[2], nullptr, 0, 0, -1, (TransitionType) 0, 8},
+    {&symbols[11], &states[8], nullptr, 0, 0, -1, (TransitionType) 0, 9},
+    {&symbols[13], &states[6], nullptr, 0, 0, -1, (TransitionType) 0, 10},
+    {&symbols[1], nullptr, &symbols[0], 1, 0, -1, (TransitionType) 1, 11},
+    {&symbols[2], &states[1], nullptr, 0, 0, -1, (TransitionType) 0, 12},
+    {&symbols[3], &states[2], nullptr, 0, 0, -1, (TransitionType) 0, 13},
+    {&symbols[10], &states[9], nullptr, 0, 0, -1, (TransitionType) 0, 14},
+    {&symbols[11], &states[5], nullptr, 0, 0, -1, (TransitionType) 0, 15},
+    {&symbols[13], &states[6], nullptr, 0, 0, -1, (TransitionType) 0, 16},
     {&symbols[1], nullptr, &symbols[9], 1, 0, -1, (TransitionType) 1, 17},
     {&symbols[2], nullptr, &symbols[9], 1, 0, -1, (TransitionType) 1, 18},
     {&symbols[3], nullptr, &symbols[9], 1, 0, -1, (TransitionType) 1, 19},
     {&symbols[13], nullptr, &symbols[9], 1, 0, -1, (TransitionType) 1, 20},
-    {&symbols[2], &states[12], nullptr, 0, 0, -1, (TransitionType) 0, 21},
-    {&symbols[5], &states[8], nullptr, 0, 0, -1, (TransitionType) 0, 22},
-    {&symbols[6], &states[9], nullptr, 0, 0, -1, (TransitionType) 0, 23},
-    {&symbols[7], &states[10], nullptr, 0, 0, -1, (TransitionType) 0, 24},
-    {&symbols[8], &states[11], nullptr, 0, 0, -1, (TransitionType) 0, 25},
-    {&symbols[12], &states[5], nullptr, 0, 0, -1, (TransitionType) 0, 26},
-    {&symbols[1], nullptr, &symbols[10], 2, 0, 0, (TransitionType) 1, 27},
-    {&symbols[2], nullptr, &symbols[10], 2, 0, 0, (TransitionType) 1, 28},
-    {&symbols[3], nullptr, &symbols[10], 2, 0, 0, (TransitionType) 1, 29},
-    {&symbols[13], nullptr, &symbols[10], 2, 0, 0, (TransitionType) 1, 30},
-    {&symbols[12], &states[7], nullptr, 0, 0, -1, (TransitionType) 0, 31},
-    {&symbols[1], nullptr, &symbols[10], 2, 0, 1, (TransitionType) 1, 32},
-    {&symbols[2], nullptr, &symbols[10], 2, 0, 1, (TransitionType) 1, 33},
-    {&symbols[3], nullptr, &symbols[10], 2, 0, 1, (TransitionType) 1, 34},
-    {&symbols[13], nullptr, &symbols[10], 2, 0, 1, (TransitionType) 1, 35},
-    {&symbols[3], &states[13], nullptr, 0, 0, -1, (TransitionType) 0, 36},
-    {&symbols[11], &states[14], nullptr, 0, 0, -1, (TransitionType) 0, 37},
-    {&symbols[13], &states[21], nullptr, 0, 0, -1, (TransitionType) 0, 38},
-    {&symbols[3], &states[13], nullptr, 0, 0, -1, (TransitionType) 0, 39},
-    {&symbols[11], &states[15], nullptr, 0, 0, -1, (TransitionType) 0, 40},
-    {&symbols[13], &states[21], nullptr, 0, 0, -1, (TransitionType) 0, 41},
-    {&symbols[3], &states[13], nullptr, 0, 0, -1, (TransitionType) 0, 42},
-    {&symbols[11], &states[16], nullptr, 0, 0, -1, (TransitionType) 0, 43},
-    {&symbols[13], &states[21], nullptr, 0, 0, -1, (TransitionType) 0, 44},
-    {&symbols[3], &states[13], nullptr, 0, 0, -1, (TransitionType) 0, 45},
-    {&symbols[11], &states[17], nullptr, 0, 0, -1, (TransitionType) 0, 46},
-    {&symbols[13], &states[21], nullptr, 0, 0, -1, (TransitionType) 0, 47},
-    {&symbols[3], &states[13], nullptr, 0, 0, -1, (TransitionType) 0, 48},
-    {&symbols[11], &states[18], nullptr, 0, 0, -1, (TransitionType) 0, 49},
-    {&symbols[13], &states[21], nullptr, 0, 0, -1, (TransitionType) 0, 50},
-    {&symbols[3], &states[13], nullptr, 0, 0, -1, (TransitionType) 0, 51},
-    {&symbols[11], &states[19], nullptr, 0, 0, -1, (TransitionType) 0, 52},
-    {&symbols[13], &states[21], nullptr, 0, 0, -1, (TransitionType) 0, 53},
-    {&symbols[2], nullptr, &symbols[11], 3, 3, 2, (TransitionType) 1, 54},
-    {&symbols[4], nullptr, &symbols[11], 3, 3, 2, (TransitionType) 1, 55},
-    {&symbols[5], &states[8], nullptr, 0, 0, -1, (TransitionType) 0, 56},
-    {&symbols[6], &states[9], nullptr, 0, 0, -1, (TransitionType) 0, 57},
-    {&symbols[7], &states[10], nullptr, 0, 0, -1, (TransitionType) 0, 58},
-    {&symbols[8], &states[11], nullptr, 0, 0, -1, (TransitionType) 0, 59},
-    {&symbols[12], nullptr, &symbols[11], 3, 3, 2, (TransitionType) 1, 60},
-    {&symbols[2], nullptr, &symbols[11], 3, 3, 3, (TransitionType) 1, 61},
-    {&symbols[4], nullptr, &symbols[11], 3, 3, 3, (TransitionType) 1, 62},
-    {&symbols[5], &states[8], nullptr, 0, 0, -1, (TransitionType) 0, 63},
-    {&symbols[6], &states[9], nullptr, 0, 0, -1, (TransitionType) 0, 64},
-    {&symbols[7], &states[10], nullptr, 0, 0, -1, (TransitionType) 0, 65},
-    {&symbols[8], &states[11], nullptr, 0, 0, -1, (TransitionType) 0, 66},
-    {&symbols[12], nullptr, &symbols[11], 3, 3, 3, (TransitionType) 1, 67},
-    {&symbols[2], nullptr, &symbols[11], 3, 4, 4, (TransitionType) 1, 68},
-    {&symbols[4], nullptr, &symbols[11], 3, 4, 4, (TransitionType) 1, 69},
-    {&symbols[5], nullptr, &symbols[11], 3, 4, 4, (TransitionType) 1, 70},
-    {&symbols[6], nullptr, &symbols[11], 3, 4, 4, (TransitionType) 1, 71},
-    {&symbols[7], &states[10], nullptr, 0, 0, -1, (TransitionType) 0, 72},
-    {&symbols[8], &states[11], nullptr, 0, 0, -1, (TransitionType) 0, 73},
-    {&symbols[12], nullptr, &symbols[11], 3, 4, 4, (TransitionType) 1, 74},
-    {&symbols[2], nullptr, &symbols[11], 3, 4, 5, (TransitionType) 1, 75},
-    {&symbols[4], nullptr, &symbols[11], 3, 4, 5, (TransitionType) 1, 76},
-    {&symbols[5], nullptr, &symbols[11], 3, 4, 5, (TransitionType) 1, 77},
-    {&symbols[6], nullptr, &symbols[11], 3, 4, 5, (TransitionType) 1, 78},
-    {&symbols[7], &states[10], nullptr, 0, 0, -1, (TransitionType) 0, 79},
-    {&symbols[8], &states[11], nullptr, 0, 0, -1, (TransitionType) 0, 80},
-    {&symbols[12], nullptr, &symbols[11], 3, 4, 5, (TransitionType) 1, 81},
-    {&symbols[2], &states[12], nullptr, 0, 0, -1, (TransitionType) 0, 82},
-    {&symbols[4], nullptr, &symbols[11], 3, 1, 6, (TransitionType) 1, 83},
-    {&symbols[5], &states[8], nullptr, 0, 0, -1, (TransitionType) 0, 84},
-    {&symbols[6], &states[9], nullptr, 0, 0, -1, (TransitionType) 0, 85},
-    {&symbols[7], &states[10], nullptr, 0, 0, -1, (TransitionType) 0, 86},
-    {&symbols[8], &states[11], nullptr, 0, 0, -1, (TransitionType) 0, 87},
-    {&symbols[12], nullptr, &symbols[11], 3, 1, 6, (TransitionType) 1, 88},
-    {&symbols[2], &states[12], nullptr, 0, 0, -1, (TransitionType) 0, 89},
-    {&symbols[4], &states[20], nullptr, 0, 0, -1, (TransitionType) 0, 90},
-    {&symbols[5], &states[8], nullptr, 0, 0, -1, (TransitionType) 0, 91},
-    {&symbols[6], &states[9], nullptr, 0, 0, -1, (TransitionType) 0, 92},
-    {&symbols[7], &states[10], nullptr, 0, 0, -1, (TransitionType) 0, 93},
-    {&symbols[8], &states[11], nullptr, 0, 0, -1, (TransitionType) 0, 94},
-    {&symbols[2], nullptr, &symbols[11], 3, 2, 7, (TransitionType) 1, 95},
-    {&symbols[4], nullptr, &symbols[11], 3, 2, 7, (TransitionType) 1, 96},
-    {&symbols[5], nullptr, &symbols[11], 3, 2, 7, (TransitionType) 1, 97},
-    {&symbols[6], nullptr, &symbols[11], 3, 2, 7, (TransitionType) 1, 98},
-    {&symbols[7], nullptr, &symbols[11], 3, 2, 7, (TransitionType) 1, 99},
-    {&symbols[8], nullptr, &symbols[11], 3, 2, 7, (TransitionType) 1, 100},
-    {&symbols[12], nullptr, &symbols[11], 3, 2, 7, (TransitionType) 1, 101},
-    {&symbols[2], nullptr, &symbols[11], 1, 5, 8, (TransitionType) 1, 102},
-    {&symbols[4], nullptr, &symbols[11], 1, 5, 8, (TransitionType) 1, 103},
-    {&symbols[5], nullptr, &symbols[11], 1, 5, 8, (TransitionType) 1, 104},
-    {&symbols[6], nullptr, &symbols[11], 1, 5, 8, (TransitionType) 1, 105},
-    {&symbols[7], nullptr, &symbols[11], 1, 5, 8, (TransitionType) 1, 106},
-    {&symbols[8], nullptr, &symbols[11], 1, 5, 8, (TransitionType) 1, 107},
-    {&symbols[12], nullptr, &symbols[11], 1, 5, 8, (TransitionType) 1, 108},
+    {&symbols[2], &states[10], nullptr, 0, 0, -1, (TransitionType) 0, 21},
+    {&symbols[5], &states[11], nullptr, 0, 0, -1, (TransitionType) 0, 22},
+    {&symbols[6], &states[12], nullptr, 0, 0, -1, (TransitionType) 0, 23},
+    {&symbols[7], &states[13], nullptr, 0, 0, -1, (TransitionType) 0, 24},
+    {&symbols[8], &states[14], nullptr, 0, 0, -1, (TransitionType) 0, 25},
+    {&symbols[12], &states[15], nullptr, 0, 0, -1, (TransitionType) 0, 26},
+    {&symbols[2], nullptr, &symbols[11], 1, 5, 8, (TransitionType) 1, 27},
+    {&symbols[4], nullptr, &symbols[11], 1, 5, 8, (TransitionType) 1, 28},
+    {&symbols[5], nullptr, &symbols[11], 1, 5, 8, (TransitionType) 1, 29},
+    {&symbols[6], nullptr, &symbols[11], 1, 5, 8, (TransitionType) 1, 30},
+    {&symbols[7], nullptr, &symbols[11], 1, 5, 8, (TransitionType) 1, 31},
+    {&symbols[8], nullptr, &symbols[11], 1, 5, 8, (TransitionType) 1, 32},
+    {&symbols[12], nullptr, &symbols[11], 1, 5, 8, (TransitionType) 1, 33},
+    {&symbols[1], nullptr, &symbols[10], 2, 0, 1, (TransitionType) 1, 34},
+    {&symbols[2], nullptr, &symbols[10], 2, 0, 1, (TransitionType) 1, 35},
+    {&symbols[3], nullptr, &symbols[10], 2, 0, 1, (TransitionType) 1, 36},
+    {&symbols[13], nullptr, &symbols[10], 2, 0, 1, (TransitionType) 1, 37},
+    {&symbols[2], &states[10], nullptr, 0, 0, -1, (TransitionType) 0, 38},
+    {&symbols[4], &states[16], nullptr, 0, 0, -1, (TransitionType) 0, 39},
+    {&symbols[5], &states[11], nullptr, 0, 0, -1, (TransitionType) 0, 40},
+    {&symbols[6], &states[12], nullptr, 0, 0, -1, (TransitionType) 0, 41},
+    {&symbols[7], &states[13], nullptr, 0, 0, -1, (TransitionType) 0, 42},
+    {&symbols[8], &states[14], nullptr, 0, 0, -1, (TransitionType) 0, 43},
+    {&symbols[1], nullptr, &symbols[9], 2, 0, -1, (TransitionType) 1, 44},
+    {&symbols[2], nullptr, &symbols[9], 2, 0, -1, (TransitionType) 1, 45},
+    {&symbols[3], nullptr, &symbols[9], 2, 0, -1, (TransitionType) 1, 46},
+    {&symbols[13], nullptr, &symbols[9], 2, 0, -1, (TransitionType) 1, 47},
+    {&symbols[3], &states[2], nullptr, 0, 0, -1, (TransitionType) 0, 48},
+    {&symbols[11], &states[17], nullptr, 0, 0, -1, (TransitionType) 0, 49},
+    {&symbols[13], &states[6], nullptr, 0, 0, -1, (TransitionType) 0, 50},
+    {&symbols[3], &states[2], nullptr, 0, 0, -1, (TransitionType) 0, 51},
+    {&symbols[11], &states[18], nullptr, 0, 0, -1, (TransitionType) 0, 52},
+    {&symbols[13], &states[6], nullptr, 0, 0, -1, (TransitionType) 0, 53},
+    {&symbols[3], &states[2], nullptr, 0, 0, -1, (TransitionType) 0, 54},
+    {&symbols[11], &states[19], nullptr, 0, 0, -1, (TransitionType) 0, 55},
+    {&symbols[13], &states[6], nullptr, 0, 0, -1, (TransitionType) 0, 56},
+    {&symbols[3], &states[2], nullptr, 0, 0, -1, (TransitionType) 0, 57},
+    {&symbols[11], &states[20], nullptr, 0, 0, -1, (TransitionType) 0, 58},
+    {&symbols[13], &states[6], nullptr, 0, 0, -1, (TransitionType) 0, 59},
+    {&symbols[3], &states[2], nullptr, 0, 0, -1, (TransitionType) 0, 60},
+    {&symbols[11], &states[21], nullptr, 0, 0, -1, (TransitionType) 0, 61},
+    {&symbols[13], &states[6], nullptr, 0, 0, -1, (TransitionType) 0, 62},
+    {&symbols[1], nullptr, &symbols[10], 2, 0, 0, (TransitionType) 1, 63},
+    {&symbols[2], nullptr, &symbols[10], 2, 0, 0, (TransitionType) 1, 64},
+    {&symbols[3], nullptr, &symbols[10], 2, 0, 0, (TransitionType) 1, 65},
+    {&symbols[13], nullptr, &symbols[10], 2, 0, 0, (TransitionType) 1, 66},
+    {&symbols[2], nullptr, &symbols[11], 3, 2, 7, (TransitionType) 1, 67},
+    {&symbols[4], nullptr, &symbols[11], 3, 2, 7, (TransitionType) 1, 68},
+    {&symbols[5], nullptr, &symbols[11], 3, 2, 7, (TransitionType) 1, 69},
+    {&symbols[6], nullptr, &symbols[11], 3, 2, 7, (TransitionType) 1, 70},
+    {&symbols[7], nullptr, &symbols[11], 3, 2, 7, (TransitionType) 1, 71},
+    {&symbols[8], nullptr, &symbols[11], 3, 2, 7, (TransitionType) 1, 72},
+    {&symbols[12], nullptr, &symbols[11], 3, 2, 7, (TransitionType) 1, 73},
+    {&symbols[2], &states[10], nullptr, 0, 0, -1, (TransitionType) 0, 74},
+    {&symbols[4], nullptr, &symbols[11], 3, 1, 6, (TransitionType) 1, 75},
+    {&symbols[5], &states[11], nullptr, 0, 0, -1, (TransitionType) 0, 76},
+    {&symbols[6], &states[12], nullptr, 0, 0, -1, (TransitionType) 0, 77},
+    {&symbols[7], &states[13], nullptr, 0, 0, -1, (TransitionType) 0, 78},
+    {&symbols[8], &states[14], nullptr, 0, 0, -1, (TransitionType) 0, 79},
+    {&symbols[12], nullptr, &symbols[11], 3, 1, 6, (TransitionType) 1, 80},
+    {&symbols[2], nullptr, &symbols[11], 3, 3, 2, (TransitionType) 1, 81},
+    {&symbols[4], nullptr, &symbols[11], 3, 3, 2, (TransitionType) 1, 82},
+    {&symbols[5], &states[11], nullptr, 0, 0, -1, (TransitionType) 0, 83},
+    {&symbols[6], &states[12], nullptr, 0, 0, -1, (TransitionType) 0, 84},
+    {&symbols[7], &states[13], nullptr, 0, 0, -1, (TransitionType) 0, 85},
+    {&symbols[8], &states[14], nullptr, 0, 0, -1, (TransitionType) 0, 86},
+    {&symbols[12], nullptr, &symbols[11], 3, 3, 2, (TransitionType) 1, 87},
+    {&symbols[2], nullptr, &symbols[11], 3, 3, 3, (TransitionType) 1, 88},
+    {&symbols[4], nullptr, &symbols[11], 3, 3, 3, (TransitionType) 1, 89},
+    {&symbols[5], &states[11], nullptr, 0, 0, -1, (TransitionType) 0, 90},
+    {&symbols[6], &states[12], nullptr, 0, 0, -1, (TransitionType) 0, 91},
+    {&symbols[7], &states[13], nullptr, 0, 0, -1, (TransitionType) 0, 92},
+    {&symbols[8], &states[14], nullptr, 0, 0, -1, (TransitionType) 0, 93},
+    {&symbols[12], nullptr, &symbols[11], 3, 3, 3, (TransitionType) 1, 94},
+    {&symbols[2], nullptr, &symbols[11], 3, 4, 4, (TransitionType) 1, 95},
+    {&symbols[4], nullptr, &symbols[11], 3, 4, 4, (TransitionType) 1, 96},
+    {&symbols[5], nullptr, &symbols[11], 3, 4, 4, (TransitionType) 1, 97},
+    {&symbols[6], nullptr, &symbols[11], 3, 4, 4, (TransitionType) 1, 98},
+    {&symbols[7], &states[13], nullptr, 0, 0, -1, (TransitionType) 0, 99},
+    {&symbols[8], &states[14], nullptr, 0, 0, -1, (TransitionType) 0, 100},
+    {&symbols[12], nullptr, &symbols[11], 3, 4, 4, (TransitionType) 1, 101},
+    {&symbols[2], nullptr, &symbols[11], 3, 4, 5, (TransitionType) 1, 102},
+    {&symbols[4], nullptr, &symbols[11], 3, 4, 5, (TransitionType) 1, 103},
+    {&symbols[5], nullptr, &symbols[11], 3, 4, 5, (TransitionType) 1, 104},
+    {&symbols[6], nullptr, &symbols[11], 3, 4, 5, (TransitionType) 1, 105},
+    {&symbols[7], &states[13], nullptr, 0, 0, -1, (TransitionType) 0, 106},
+    {&symbols[8], &states[14], nullptr, 0, 0, -1, (TransitionType) 0, 107},
+    {&symbols[12], nullptr, &symbols[11], 3, 4, 5, (TransitionType) 1, 108},
     {nullptr, nullptr, nullptr, 0, 0, 0, (TransitionType) 0, -1}
 };
 
 const ParserState states [] = 
 {
-    {0, 7, &transitions[0]},
-    {1, 6, &transitions[7]},
-    {2, 4, &transitions[13]},
-    {3, 4, &transitions[17]},
-    {4, 6, &transitions[21]},
-    {5, 4, &transitions[27]},
-    {6, 1, &transitions[31]},
-    {7, 4, &transitions[32]},
-    {8, 3, &transitions[36]},
-    {9, 3, &transitions[39]},
-    {10, 3, &transitions[42]},
-    {11, 3, &transitions[45]},
-    {12, 3, &transitions[48]},
-    {13, 3, &transitions[51]},
-    {14, 7, &transitions[54]},
-    {15, 7, &transitions[61]},
-    {16, 7, &transitions[68]},
-    {17, 7, &transitions[75]},
-    {18, 7, &transitions[82]},
-    {19, 6, &transitions[89]},
-    {20, 7, &transitions[95]},
-    {21, 7, &transitions[102]},
-    {-1, 0, nullptr}
+    {0, 7, &transitions[0], nullptr},
+    {1, 1, &transitions[7], nullptr},
+    {2, 3, &transitions[8], nullptr},
+    {3, 6, &transitions[11], nullptr},
+    {4, 4, &transitions[17], &transitions[17]},
+    {5, 6, &transitions[21], nullptr},
+    {6, 7, &transitions[27], &transitions[27]},
+    {7, 4, &transitions[34], &transitions[34]},
+    {8, 6, &transitions[38], nullptr},
+    {9, 4, &transitions[44], &transitions[44]},
+    {10, 3, &transitions[48], nullptr},
+    {11, 3, &transitions[51], nullptr},
+    {12, 3, &transitions[54], nullptr},
+    {13, 3, &transitions[57], nullptr},
+    {14, 3, &transitions[60], nullptr},
+    {15, 4, &transitions[63], &transitions[63]},
+    {16, 7, &transitions[67], &transitions[67]},
+    {17, 7, &transitions[74], nullptr},
+    {18, 7, &transitions[81], nullptr},
+    {19, 7, &transitions[88], nullptr},
+    {20, 7, &transitions[95], nullptr},
+    {21, 7, &transitions[102], nullptr},
+    {-1, 0, nullptr, nullptr}
+};
+
+const int action_table [] = 
+{
+    -1, 0, 1, 2, -1, -1, -1, -1, -1, 3, 4, 5, -1, 6,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 7, -1,
+    -1, -1, -1, 8, -1, -1, -1, -1, -1, -1, -1, 9, -1, 10,
+    -1, 11, 12, 13, -1, -1, -1, -1, -1, -1, 14, 15, -1, 16,
+    -1, 17, 18, 19, -1, -1, -1, -1, -1, -1, -1, -1, -1, 20,
+    -1, -1, 21, -1, -1, 22, 23, 24, 25, -1, -1, -1, 26, -1,
+    -1, -1, 27, -1, 28, 29, 30, 31, 32, -1, -1, -1, 33, -1,
+    -1, 34, 35, 36, -1, -1, -1, -1, -1, -1, -1, -1, -1, 37,
+    -1, -1, 38, -1, 39, 40, 41, 42, 43, -1, -1, -1, -1, -1,
+    -1, 44, 45, 46, -1, -1, -1, -1, -1, -1, -1, -1, -1, 47,
+    -1, -1, -1, 48, -1, -1, -1, -1, -1, -1, -1, 49, -1, 50,
+    -1, -1, -1, 51, -1, -1, -1, -1, -1, -1, -1, 52, -1, 53,
+    -1, -1, -1, 54, -1, -1, -1, -1, -1, -1, -1, 55, -1, 56,
+    -1, -1, -1, 57, -1, -1, -1, -1, -1, -1, -1, 58, -1, 59,
+    -1, -1, -1, 60, -1, -1, -1, -1, -1, -1, -1, 61, -1, 62,
+    -1, 63, 64, 65, -1, -1, -1, -1, -1, -1, -1, -1, -1, 66,
+    -1, -1, 67, -1, 68, 69, 70, 71, 72, -1, -1, -1, 73, -1,
+    -1, -1, 74, -1, 75, 76, 77, 78, 79, -1, -1, -1, 80, -1,
+    -1, -1, 81, -1, 82, 83, 84, 85, 86, -1, -1, -1, 87, -1,
+    -1, -1, 88, -1, 89, 90, 91, 92, 93, -1, -1, -1, 94, -1,
+    -1, -1, 95, -1, 96, 97, 98, 99, 100, -1, -1, -1, 101, -1,
+    -1, -1, 102, -1, 103, 104, 105, 106, 107, -1, -1, -1, 108, -1,
+    0
+};
+
+const int goto_table [] = 
+{
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 3, 4, 5, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 8, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 9, 5, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 17, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 18, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 19, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 20, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 21, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    0
 };
 
 const LexerAction lexer_actions [] = 
@@ -206,81 +268,112 @@ const LexerAction lexer_actions [] =
 
 const LexerTransition lexer_transitions [] = 
 {
+    {9, 11, &lexer_states[14], nullptr},
+    {13, 14, &lexer_states[14], nullptr},
+    {32, 33, &lexer_states[14], nullptr},
     {40, 41, &lexer_states[6], nullptr},
-    {41, 42, &lexer_states[9], nullptr},
-    {42, 43, &lexer_states[8], nullptr},
-    {43, 44, &lexer_states[10], nullptr},
-    {45, 46, &lexer_states[7], nullptr},
-    {47, 48, &lexer_states[13], nullptr},
-    {48, 58, &lexer_states[11], nullptr},
+    {41, 42, &lexer_states[7], nullptr},
+    {42, 43, &lexer_states[10], nullptr},
+    {43, 44, &lexer_states[8], nullptr},
+    {45, 46, &lexer_states[9], nullptr},
+    {47, 48, &lexer_states[11], nullptr},
+    {48, 58, &lexer_states[13], nullptr},
     {59, 60, &lexer_states[12], nullptr},
     {101, 102, &lexer_states[1], nullptr},
     {114, 115, &lexer_states[2], nullptr},
     {114, 115, &lexer_states[3], nullptr},
     {111, 112, &lexer_states[4], nullptr},
     {114, 115, &lexer_states[5], nullptr},
-    {48, 58, &lexer_states[11], nullptr},
+    {48, 58, &lexer_states[13], nullptr},
+    {9, 11, &lexer_states[14], nullptr},
+    {13, 14, &lexer_states[14], nullptr},
+    {32, 33, &lexer_states[14], nullptr},
     {-1, -1, nullptr, nullptr}
 };
 
-const LexerState lexer_states [] = 
+const LexerLoop lexer_loops [] = 
 {
-    {0, 9, &lexer_transitions[0], nullptr},
-    {1, 1, &lexer_transitions[9], nullptr},
-    {2, 1, &lexer_transitions[10], nullptr},
-    {3, 1, &lexer_transitions[11], nullptr},
-    {4, 1, &lexer_transitions[12], nullptr},
-    {5, 0, &lexer_transitions[13], &symbols[2]},
-    {6, 0, &lexer_transitions[13], &symbols[3]},
-    {7, 0, &lexer_transitions[13], &symbols[6]},
-    {8, 0, &lexer_transitions[13], &symbols[7]},
-    {9, 0, &lexer_transitions[13], &symbols[4]},
-    {10, 0, &lexer_transitions[13], &symbols[5]},
-    {11, 1, &lexer_transitions[13], &symbols[13]},
-    {12, 0, &lexer_transitions[14], &symbols[12]},
-    {13, 0, &lexer_transitions[14], &symbols[8]},
-    {-1, 0, nullptr, nullptr}
+    {{0, 0, 0, 0, 0, 0, 255, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 1, {48, 57, 0, 0, 0, 0, 0, 0}},
+    {{0, 38, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 3, {9, 10, 13, 13, 32, 32, 0, 0}},
+    {{0}, 0, {0}}
 };
 
-const LexerStateMachine lexer_state_machine = 
-{
-    0, // #actions
-    14, // #transitions
-    14, // #states
-    lexer_actions, // actions
-    lexer_transitions, // transitions
-    lexer_states, // states
-    &lexer_states[0] // start state
-};
-
-const LexerAction whitespace_lexer_actions [] = 
+const LexerState lexer_states [] = 
 {
-    {-1, nullptr}
+    {0, 12, &lexer_transitions[0], &parser_state_machine, nullptr},
+    {1, 1, &lexer_transitions[12], nullptr, nullptr},
+    {2, 1, &lexer_transitions[13], nullptr, nullptr},
+    {3, 1, &lexer_transitions[14], nullptr, nullptr},
+    {4, 1, &lexer_transitions[15], nullptr, nullptr},
+    {5, 0, &lexer_transitions[16], &symbols[2], nullptr},
+    {6, 0, &lexer_transitions[16], &symbols[3], nullptr},
+    {7, 0, &lexer_transitions[16], &symbols[4], nullptr},
+    {8, 0, &lexer_transitions[16], &symbols[5], nullptr},
+    {9, 0, &lexer_transitions[16], &symbols[6], nullptr},
+    {10, 0, &lexer_transitions[16], &symbols[7], nullptr},
+    {11, 0, &lexer_transitions[16], &symbols[8], nullptr},
+    {12, 0, &lexer_transitions[16], &symbols[12], nullptr},
+    {13, 1, &lexer_transitions[16], &symbols[13], &lexer_loops[0]},
+    {14, 3, &lexer_transitions[17], &parser_state_machine, &lexer_loops[1]},
+    {-1, 0, nullptr, nullptr, nullptr}
 };
 
-const LexerTransition whitespace_lexer_transitions [] = 
+const unsigned char lexer_character_classes [] = 
 {
-    {9, 11, &whitespace_lexer_states[0], nullptr},
-    {13, 14, &whitespace_lexer_states[0], nullptr},
-    {32, 33, &whitespace_lexer_states[0], nullptr},
-    {-1, -1, nullptr, nullptr}
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 0, 0, 0, 0, 0, 0, 4, 5, 6, 7, 0, 8, 0, 9,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 11, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13,
+    0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0
 };
 
-const LexerState whitespace_lexer_states [] = 
+const int lexer_transition_table [] = 
 {
-    {0, 3, &whitespace_lexer_transitions[0], nullptr},
-    {-1, 0, nullptr, nullptr}
+    -1, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 12,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 13,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 14, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 15,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 16, -1, -1, -1, -1,
+    -1, 17, 18, 19, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    0
 };
 
-const LexerStateMachine whitespace_lexer_state_machine = 
+const LexerStateMachine lexer_state_machine = 
 {
     0, // #actions
-    3, // #transitions
-    1, // #states
-    whitespace_lexer_actions, // actions
-    whitespace_lexer_transitions, // transitions
-    whitespace_lexer_states, // states
-    &whitespace_lexer_states[0] // start state
+    20, // #transitions
+    15, // #states
+    lexer_actions, // actions
+    lexer_transitions, // transitions
+    lexer_states, // states
+    &lexer_states[0], // start state
+    15, // #classes
+    lexer_character_classes, // character classes
+    lexer_transition_table, // transition table
+    &parser_state_machine, // skip symbol
+    2, // #loops
+    lexer_loops // loops
 };
 
 const ParserStateMachine parser_state_machine = 
@@ -299,7 +392,14 @@ const ParserStateMachine parser_state_machine =
     &symbols[2], // error symbol
     &states[0], // start state
     &lexer_state_machine, // lexer state machine
-    &whitespace_lexer_state_machine // whitespace lexer state machine
+    nullptr, // whitespace lexer state machine
+    action_table, // action table
+    goto_table, // goto table
+    0, // #compressed table entries
+    nullptr, // default table
+    nullptr, // base table
+    nullptr, // next table
+    nullptr // check table
 };
 
 }
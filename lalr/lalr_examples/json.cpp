@@ -7,6 +7,7 @@
 #include <lalr/LexerStateMachine.hpp>
 #include <lalr/LexerState.hpp>
 #include <lalr/LexerTransition.hpp>
+#include <lalr/LexerLoop.hpp>
 #include <lalr/LexerAction.hpp>
 
 using namespace lalr;
@@ -24,6 +25,13 @@ extern const ParserAction actions [];
 extern const ParserSymbol symbols [];
 extern const ParserTransition transitions [];
 extern const ParserState states [];
+extern const int action_table [];
+extern const int goto_table [];
+extern const int default_table [];
+extern const int base_table [];
+extern const int next_table [];
+extern const int check_table [];
+extern const ParserStateMachine parser_state_machine;
 
 const ParserAction actions [] = 
 {
@@ -55,9 +63,9 @@ const ParserSymbol symbols [] =
     {13, "null_terminal", "null", (SymbolType) 1},
     {14, "true_terminal", "true", (SymbolType) 1},
     {15, "false_terminal", "false", (SymbolType) 1},
-    {16, "string", "[\"']:string:", (SymbolType) 1},
-    {17, "integer", "(\+|\-)?[0-9]+", (SymbolType) 1},
-    {18, "real", "(\+|\-)?[0-9]+(\.[0-9]+)?((e|E)(\+|\-)?[0-9]+)?", (SymbolType) 1},
+    {16, "string", "[\\\"']:string:", (SymbolType) 1},
+    {17, "integer", "(\\+|\\-)?[0-9]+", (SymbolType) 1},
+    {18, "real", "(\\+|\\-)?[0-9]+(\\.[0-9]+)?((e|E)(\\+|\\-)?[0-9]+)?", (SymbolType) 1},
     {-1, nullptr, nullptr, (SymbolType) 0}
 };
 
@@ -67,41 +75,41 @@ const ParserTransition transitions [] =
     {&symbols[4], &states[2], nullptr, 0, 0, -1, (TransitionType) 0, 1},
     {&symbols[1], nullptr, &symbols[0], 1, 0, -1, (TransitionType) 1, 2},
     {&symbols[5], &states[3], nullptr, 0, 0, -1, (TransitionType) 0, 3},
-    {&symbols[16], &states[7], nullptr, 0, 0, -1, (TransitionType) 0, 4},
-    {&symbols[6], &states[4], nullptr, 0, 0, -1, (TransitionType) 0, 5},
-    {&symbols[1], nullptr, &symbols[3], 3, 0, 0, (TransitionType) 1, 6},
-    {&symbols[5], &states[16], nullptr, 0, 0, -1, (TransitionType) 0, 7},
-    {&symbols[8], &states[11], nullptr, 0, 0, -1, (TransitionType) 0, 8},
-    {&symbols[10], &states[14], nullptr, 0, 0, -1, (TransitionType) 0, 9},
-    {&symbols[11], &states[15], nullptr, 0, 0, -1, (TransitionType) 0, 10},
-    {&symbols[16], &states[8], nullptr, 0, 0, -1, (TransitionType) 0, 11},
-    {&symbols[5], &states[16], nullptr, 0, 0, -1, (TransitionType) 0, 12},
-    {&symbols[10], &states[13], nullptr, 0, 0, -1, (TransitionType) 0, 13},
-    {&symbols[11], &states[15], nullptr, 0, 0, -1, (TransitionType) 0, 14},
-    {&symbols[16], &states[8], nullptr, 0, 0, -1, (TransitionType) 0, 15},
-    {&symbols[7], &states[9], nullptr, 0, 0, -1, (TransitionType) 0, 16},
-    {&symbols[7], &states[10], nullptr, 0, 0, -1, (TransitionType) 0, 17},
-    {&symbols[4], &states[5], nullptr, 0, 0, -1, (TransitionType) 0, 18},
-    {&symbols[4], &states[5], nullptr, 0, 0, -1, (TransitionType) 0, 19},
-    {&symbols[12], &states[17], nullptr, 0, 0, -1, (TransitionType) 0, 20},
-    {&symbols[13], &states[18], nullptr, 0, 0, -1, (TransitionType) 0, 21},
-    {&symbols[14], &states[19], nullptr, 0, 0, -1, (TransitionType) 0, 22},
-    {&symbols[15], &states[20], nullptr, 0, 0, -1, (TransitionType) 0, 23},
-    {&symbols[16], &states[23], nullptr, 0, 0, -1, (TransitionType) 0, 24},
-    {&symbols[17], &states[21], nullptr, 0, 0, -1, (TransitionType) 0, 25},
-    {&symbols[18], &states[22], nullptr, 0, 0, -1, (TransitionType) 0, 26},
-    {&symbols[6], &states[12], nullptr, 0, 0, -1, (TransitionType) 0, 27},
-    {&symbols[9], &states[6], nullptr, 0, 0, -1, (TransitionType) 0, 28},
-    {&symbols[6], nullptr, &symbols[5], 5, 0, 1, (TransitionType) 1, 29},
-    {&symbols[9], nullptr, &symbols[5], 5, 0, 1, (TransitionType) 1, 30},
-    {&symbols[6], nullptr, &symbols[8], 3, 0, 2, (TransitionType) 1, 31},
-    {&symbols[9], nullptr, &symbols[8], 3, 0, 2, (TransitionType) 1, 32},
-    {&symbols[6], nullptr, &symbols[8], 1, 0, 3, (TransitionType) 1, 33},
-    {&symbols[9], nullptr, &symbols[8], 1, 0, 3, (TransitionType) 1, 34},
-    {&symbols[6], nullptr, &symbols[10], 1, 0, 4, (TransitionType) 1, 35},
-    {&symbols[9], nullptr, &symbols[10], 1, 0, 4, (TransitionType) 1, 36},
-    {&symbols[6], nullptr, &symbols[10], 1, 0, 4, (TransitionType) 1, 37},
-    {&symbols[9], nullptr, &symbols[10], 1, 0, 4, (TransitionType) 1, 38},
+    {&symbols[16], &states[4], nullptr, 0, 0, -1, (TransitionType) 0, 4},
+    {&symbols[6], &states[5], nullptr, 0, 0, -1, (TransitionType) 0, 5},
+    {&symbols[7], &states[6], nullptr, 0, 0, -1, (TransitionType) 0, 6},
+    {&symbols[1], nullptr, &symbols[3], 3, 0, 0, (TransitionType) 1, 7},
+    {&symbols[4], &states[7], nullptr, 0, 0, -1, (TransitionType) 0, 8},
+    {&symbols[5], &states[8], nullptr, 0, 0, -1, (TransitionType) 0, 9},
+    {&symbols[8], &states[9], nullptr, 0, 0, -1, (TransitionType) 0, 10},
+    {&symbols[10], &states[10], nullptr, 0, 0, -1, (TransitionType) 0, 11},
+    {&symbols[11], &states[11], nullptr, 0, 0, -1, (TransitionType) 0, 12},
+    {&symbols[16], &states[12], nullptr, 0, 0, -1, (TransitionType) 0, 13},
+    {&symbols[6], nullptr, &symbols[10], 1, 0, 4, (TransitionType) 1, 14},
+    {&symbols[9], nullptr, &symbols[10], 1, 0, 4, (TransitionType) 1, 15},
+    {&symbols[6], &states[13], nullptr, 0, 0, -1, (TransitionType) 0, 16},
+    {&symbols[9], &states[14], nullptr, 0, 0, -1, (TransitionType) 0, 17},
+    {&symbols[6], nullptr, &symbols[8], 1, 0, 3, (TransitionType) 1, 18},
+    {&symbols[9], nullptr, &symbols[8], 1, 0, 3, (TransitionType) 1, 19},
+    {&symbols[6], nullptr, &symbols[10], 1, 0, 4, (TransitionType) 1, 20},
+    {&symbols[9], nullptr, &symbols[10], 1, 0, 4, (TransitionType) 1, 21},
+    {&symbols[7], &states[15], nullptr, 0, 0, -1, (TransitionType) 0, 22},
+    {&symbols[6], nullptr, &symbols[5], 5, 0, 1, (TransitionType) 1, 23},
+    {&symbols[9], nullptr, &symbols[5], 5, 0, 1, (TransitionType) 1, 24},
+    {&symbols[5], &states[8], nullptr, 0, 0, -1, (TransitionType) 0, 25},
+    {&symbols[10], &states[16], nullptr, 0, 0, -1, (TransitionType) 0, 26},
+    {&symbols[11], &states[11], nullptr, 0, 0, -1, (TransitionType) 0, 27},
+    {&symbols[16], &states[12], nullptr, 0, 0, -1, (TransitionType) 0, 28},
+    {&symbols[4], &states[7], nullptr, 0, 0, -1, (TransitionType) 0, 29},
+    {&symbols[12], &states[17], nullptr, 0, 0, -1, (TransitionType) 0, 30},
+    {&symbols[13], &states[18], nullptr, 0, 0, -1, (TransitionType) 0, 31},
+    {&symbols[14], &states[19], nullptr, 0, 0, -1, (TransitionType) 0, 32},
+    {&symbols[15], &states[20], nullptr, 0, 0, -1, (TransitionType) 0, 33},
+    {&symbols[16], &states[21], nullptr, 0, 0, -1, (TransitionType) 0, 34},
+    {&symbols[17], &states[22], nullptr, 0, 0, -1, (TransitionType) 0, 35},
+    {&symbols[18], &states[23], nullptr, 0, 0, -1, (TransitionType) 0, 36},
+    {&symbols[6], nullptr, &symbols[8], 3, 0, 2, (TransitionType) 1, 37},
+    {&symbols[9], nullptr, &symbols[8], 3, 0, 2, (TransitionType) 1, 38},
     {&symbols[6], nullptr, &symbols[11], 3, 0, 5, (TransitionType) 1, 39},
     {&symbols[9], nullptr, &symbols[11], 3, 0, 5, (TransitionType) 1, 40},
     {&symbols[6], nullptr, &symbols[12], 1, 0, 6, (TransitionType) 1, 41},
@@ -121,31 +129,61 @@ const ParserTransition transitions [] =
 
 const ParserState states [] = 
 {
-    {0, 2, &transitions[0]},
-    {1, 1, &transitions[2]},
-    {2, 2, &transitions[3]},
-    {3, 1, &transitions[5]},
-    {4, 1, &transitions[6]},
-    {5, 5, &transitions[7]},
-    {6, 4, &transitions[12]},
-    {7, 1, &transitions[16]},
-    {8, 1, &transitions[17]},
-    {9, 1, &transitions[18]},
-    {10, 8, &transitions[19]},
-    {11, 2, &transitions[27]},
-    {12, 2, &transitions[29]},
-    {13, 2, &transitions[31]},
-    {14, 2, &transitions[33]},
-    {15, 2, &transitions[35]},
-    {16, 2, &transitions[37]},
-    {17, 2, &transitions[39]},
-    {18, 2, &transitions[41]},
-    {19, 2, &transitions[43]},
-    {20, 2, &transitions[45]},
-    {21, 2, &transitions[47]},
-    {22, 2, &transitions[49]},
-    {23, 2, &transitions[51]},
-    {-1, 0, nullptr}
+    {0, 2, &transitions[0], nullptr},
+    {1, 1, &transitions[2], nullptr},
+    {2, 2, &transitions[3], nullptr},
+    {3, 1, &transitions[5], nullptr},
+    {4, 1, &transitions[6], nullptr},
+    {5, 1, &transitions[7], &transitions[7]},
+    {6, 1, &transitions[8], nullptr},
+    {7, 5, &transitions[9], nullptr},
+    {8, 2, &transitions[14], &transitions[14]},
+    {9, 2, &transitions[16], nullptr},
+    {10, 2, &transitions[18], &transitions[18]},
+    {11, 2, &transitions[20], &transitions[20]},
+    {12, 1, &transitions[22], nullptr},
+    {13, 2, &transitions[23], &transitions[23]},
+    {14, 4, &transitions[25], nullptr},
+    {15, 8, &transitions[29], nullptr},
+    {16, 2, &transitions[37], &transitions[37]},
+    {17, 2, &transitions[39], &transitions[39]},
+    {18, 2, &transitions[41], &transitions[41]},
+    {19, 2, &transitions[43], &transitions[43]},
+    {20, 2, &transitions[45], &transitions[45]},
+    {21, 2, &transitions[47], &transitions[47]},
+    {22, 2, &transitions[49], &transitions[49]},
+    {23, 2, &transitions[51], &transitions[51]},
+    {-1, 0, nullptr, nullptr}
+};
+
+const int default_table [] = 
+{
+    -1, -1, -1, -1, -1, 7, -1, -1, 14, -1, 18, 20, -1, 23, -1, -1,
+    37, 39, 41, 43, 45, 47, 49, 51,
+    0
+};
+
+const int base_table [] = 
+{
+    2, 0, 4, 2, 4, 0, 19, 14, 0, 1, 0, 0, 21, 0, 16, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0
+};
+
+const int next_table [] = 
+{
+    -1, 2, -1, -1, 29, 0, 1, 16, 5, 3, 17, 6, 30, 31, 32, 33,
+    34, 35, 36, 9, 4, 25, 10, 8, 11, 12, 26, 27, 22, -1, 13, -1,
+    28, -1, -1, -1, -1, -1, -1, -1,
+    0
+};
+
+const int check_table [] = 
+{
+    -1, 1, -1, -1, 15, 0, 0, 9, 3, 2, 9, 4, 15, 15, 15, 15,
+    15, 15, 15, 7, 2, 14, 7, 6, 7, 7, 14, 14, 12, -1, 7, -1,
+    14, -1, -1, -1, -1, -1, -1, -1,
+    0
 };
 
 const LexerAction lexer_actions [] = 
@@ -156,86 +194,152 @@ const LexerAction lexer_actions [] =
 
 const LexerTransition lexer_transitions [] = 
 {
-    {34, 35, &lexer_states[15], nullptr},
-    {39, 40, &lexer_states[15], nullptr},
-    {43, 44, &lexer_states[29], nullptr},
-    {44, 45, &lexer_states[11], nullptr},
-    {45, 46, &lexer_states[29], nullptr},
-    {48, 58, &lexer_states[30], nullptr},
+    {34, 35, &lexer_states[31], nullptr},
+    {39, 40, &lexer_states[31], nullptr},
+    {43, 44, &lexer_states[25], nullptr},
+    {44, 45, &lexer_states[9], nullptr},
+    {45, 46, &lexer_states[25], nullptr},
+    {48, 58, &lexer_states[24], nullptr},
     {58, 59, &lexer_states[8], nullptr},
     {101, 102, &lexer_states[1], nullptr},
-    {102, 103, &lexer_states[13], nullptr},
-    {110, 111, &lexer_states[7], nullptr},
-    {116, 117, &lexer_states[12], nullptr},
+    {102, 103, &lexer_states[18], nullptr},
+    {110, 111, &lexer_states[10], nullptr},
+    {116, 117, &lexer_states[14], nullptr},
     {123, 124, &lexer_states[6], nullptr},
-    {125, 126, &lexer_states[10], nullptr},
+    {125, 126, &lexer_states[7], nullptr},
     {114, 115, &lexer_states[2], nullptr},
     {114, 115, &lexer_states[3], nullptr},
     {111, 112, &lexer_states[4], nullptr},
     {114, 115, &lexer_states[5], nullptr},
-    {117, 118, &lexer_states[9], nullptr},
-    {108, 109, &lexer_states[18], nullptr},
-    {114, 115, &lexer_states[22], nullptr},
-    {97, 98, &lexer_states[23], nullptr},
-    {0, 2147483647, &lexer_states[16], &lexer_actions[0]},
-    {108, 109, &lexer_states[17], nullptr},
-    {101, 102, &lexer_states[19], nullptr},
-    {115, 116, &lexer_states[24], nullptr},
-    {117, 118, &lexer_states[20], nullptr},
-    {108, 109, &lexer_states[21], nullptr},
-    {101, 102, &lexer_states[14], nullptr},
-    {48, 58, &lexer_states[26], nullptr},
-    {48, 58, &lexer_states[26], nullptr},
-    {69, 70, &lexer_states[31], nullptr},
-    {101, 102, &lexer_states[31], nullptr},
-    {48, 58, &lexer_states[28], nullptr},
-    {48, 58, &lexer_states[28], nullptr},
+    {117, 118, &lexer_states[11], nullptr},
+    {108, 109, &lexer_states[12], nullptr},
+    {108, 109, &lexer_states[13], nullptr},
+    {114, 115, &lexer_states[15], nullptr},
+    {117, 118, &lexer_states[16], nullptr},
+    {101, 102, &lexer_states[17], nullptr},
+    {97, 98, &lexer_states[19], nullptr},
+    {108, 109, &lexer_states[20], nullptr},
+    {115, 116, &lexer_states[21], nullptr},
+    {101, 102, &lexer_states[22], nullptr},
+    {46, 47, &lexer_states[26], nullptr},
+    {48, 58, &lexer_states[24], nullptr},
+    {69, 70, &lexer_states[28], nullptr},
+    {101, 102, &lexer_states[28], nullptr},
+    {48, 58, &lexer_states[24], nullptr},
+    {48, 58, &lexer_states[27], nullptr},
+    {48, 58, &lexer_states[27], nullptr},
+    {69, 70, &lexer_states[28], nullptr},
+    {101, 102, &lexer_states[28], nullptr},
+    {43, 44, &lexer_states[29], nullptr},
+    {45, 46, &lexer_states[29], nullptr},
     {48, 58, &lexer_states[30], nullptr},
-    {46, 47, &lexer_states[25], nullptr},
     {48, 58, &lexer_states[30], nullptr},
-    {69, 70, &lexer_states[31], nullptr},
-    {101, 102, &lexer_states[31], nullptr},
-    {43, 44, &lexer_states[27], nullptr},
-    {45, 46, &lexer_states[27], nullptr},
-    {48, 58, &lexer_states[28], nullptr},
+    {48, 58, &lexer_states[30], nullptr},
+    {0, 2147483647, &lexer_states[23], &lexer_actions[0]},
     {-1, -1, nullptr, nullptr}
 };
 
+const LexerLoop lexer_loops [] = 
+{
+    {{0, 0, 0, 0, 0, 0, 255, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 1, {48, 57, 0, 0, 0, 0, 0, 0}},
+    {{0, 0, 0, 0, 0, 0, 255, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 1, {48, 57, 0, 0, 0, 0, 0, 0}},
+    {{0, 0, 0, 0, 0, 0, 255, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 1, {48, 57, 0, 0, 0, 0, 0, 0}},
+    {{0}, 0, {0}}
+};
+
 const LexerState lexer_states [] = 
 {
-    {0, 13, &lexer_transitions[0], nullptr},
-    {1, 1, &lexer_transitions[13], nullptr},
-    {2, 1, &lexer_transitions[14], nullptr},
-    {3, 1, &lexer_transitions[15], nullptr},
-    {4, 1, &lexer_transitions[16], nullptr},
-    {5, 0, &lexer_transitions[17], &symbols[2]},
-    {6, 0, &lexer_transitions[17], &symbols[4]},
-    {7, 1, &lexer_transitions[17], nullptr},
-    {8, 0, &lexer_transitions[18], &symbols[7]},
-    {9, 1, &lexer_transitions[18], nullptr},
-    {10, 0, &lexer_transitions[19], &symbols[6]},
-    {11, 0, &lexer_transitions[19], &symbols[9]},
-    {12, 1, &lexer_transitions[19], nullptr},
-    {13, 1, &lexer_transitions[20], nullptr},
-    {14, 0, &lexer_transitions[21], &symbols[15]},
-    {15, 1, &lexer_transitions[21], nullptr},
-    {16, 0, &lexer_transitions[22], &symbols[16]},
-    {17, 0, &lexer_transitions[22], &symbols[13]},
-    {18, 1, &lexer_transitions[22], nullptr},
-    {19, 0, &lexer_transitions[23], &symbols[14]},
-    {20, 1, &lexer_transitions[23], nullptr},
-    {21, 1, &lexer_transitions[24], nullptr},
-    {22, 1, &lexer_transitions[25], nullptr},
-    {23, 1, &lexer_transitions[26], nullptr},
-    {24, 1, &lexer_transitions[27], nullptr},
-    {25, 1, &lexer_transitions[28], nullptr},
-    {26, 3, &lexer_transitions[29], &symbols[18]},
-    {27, 1, &lexer_transitions[32], nullptr},
-    {28, 1, &lexer_transitions[33], &symbols[18]},
-    {29, 1, &lexer_transitions[34], nullptr},
-    {30, 4, &lexer_transitions[35], &symbols[17]},
-    {31, 3, &lexer_transitions[39], nullptr},
-    {-1, 0, nullptr, nullptr}
+    {0, 13, &lexer_transitions[0], nullptr, nullptr},
+    {1, 1, &lexer_transitions[13], nullptr, nullptr},
+    {2, 1, &lexer_transitions[14], nullptr, nullptr},
+    {3, 1, &lexer_transitions[15], nullptr, nullptr},
+    {4, 1, &lexer_transitions[16], nullptr, nullptr},
+    {5, 0, &lexer_transitions[17], &symbols[2], nullptr},
+    {6, 0, &lexer_transitions[17], &symbols[4], nullptr},
+    {7, 0, &lexer_transitions[17], &symbols[6], nullptr},
+    {8, 0, &lexer_transitions[17], &symbols[7], nullptr},
+    {9, 0, &lexer_transitions[17], &symbols[9], nullptr},
+    {10, 1, &lexer_transitions[17], nullptr, nullptr},
+    {11, 1, &lexer_transitions[18], nullptr, nullptr},
+    {12, 1, &lexer_transitions[19], nullptr, nullptr},
+    {13, 0, &lexer_transitions[20], &symbols[13], nullptr},
+    {14, 1, &lexer_transitions[20], nullptr, nullptr},
+    {15, 1, &lexer_transitions[21], nullptr, nullptr},
+    {16, 1, &lexer_transitions[22], nullptr, nullptr},
+    {17, 0, &lexer_transitions[23], &symbols[14], nullptr},
+    {18, 1, &lexer_transitions[23], nullptr, nullptr},
+    {19, 1, &lexer_transitions[24], nullptr, nullptr},
+    {20, 1, &lexer_transitions[25], nullptr, nullptr},
+    {21, 1, &lexer_transitions[26], nullptr, nullptr},
+    {22, 0, &lexer_transitions[27], &symbols[15], nullptr},
+    {23, 0, &lexer_transitions[27], &symbols[16], nullptr},
+    {24, 4, &lexer_transitions[27], &symbols[17], &lexer_loops[0]},
+    {25, 1, &lexer_transitions[31], nullptr, nullptr},
+    {26, 1, &lexer_transitions[32], nullptr, nullptr},
+    {27, 3, &lexer_transitions[33], &symbols[18], &lexer_loops[1]},
+    {28, 3, &lexer_transitions[36], nullptr, nullptr},
+    {29, 1, &lexer_transitions[39], nullptr, nullptr},
+    {30, 1, &lexer_transitions[40], &symbols[18], &lexer_loops[2]},
+    {31, 1, &lexer_transitions[41], nullptr, nullptr},
+    {-1, 0, nullptr, nullptr, nullptr}
+};
+
+const unsigned char lexer_character_classes [] = 
+{
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 2, 0, 0, 0, 3, 4, 5, 6, 0,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 10, 0, 0, 0, 11, 12, 0, 0, 0, 0, 0, 13, 0, 14, 15,
+    0, 0, 16, 17, 18, 19, 0, 0, 0, 0, 0, 20, 0, 21, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0
+};
+
+const int lexer_transition_table [] = 
+{
+    -1, 0, 1, 2, 3, 4, -1, 5, 6, -1, -1, 7, 8, -1, 9, -1, -1, -1, 10, -1, 11, 12,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 13, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 14, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 15, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 16, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 17, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 18, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 19, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 20, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 21, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 22, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 23, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 24, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 25, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 26, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, 27, 28, -1, 29, -1, 30, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, 31, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, 32, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, 33, -1, 34, -1, 35, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, 36, -1, 37, -1, 38, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, 39, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, 40, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    0
 };
 
 const LexerStateMachine lexer_state_machine = 
@@ -246,7 +350,13 @@ const LexerStateMachine lexer_state_machine =
     lexer_actions, // actions
     lexer_transitions, // transitions
     lexer_states, // states
-    &lexer_states[0] // start state
+    &lexer_states[0], // start state
+    22, // #classes
+    lexer_character_classes, // character classes
+    lexer_transition_table, // transition table
+    nullptr, // skip symbol
+    3, // #loops
+    lexer_loops // loops
 };
 
 const LexerAction whitespace_lexer_actions [] = 
@@ -262,10 +372,43 @@ const LexerTransition whitespace_lexer_transitions [] =
     {-1, -1, nullptr, nullptr}
 };
 
+const LexerLoop whitespace_lexer_loops [] = 
+{
+    {{0, 38, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 3, {9, 10, 13, 13, 32, 32, 0, 0}},
+    {{0}, 0, {0}}
+};
+
 const LexerState whitespace_lexer_states [] = 
 {
-    {0, 3, &whitespace_lexer_transitions[0], nullptr},
-    {-1, 0, nullptr, nullptr}
+    {0, 3, &whitespace_lexer_transitions[0], nullptr, &whitespace_lexer_loops[0]},
+    {-1, 0, nullptr, nullptr, nullptr}
+};
+
+const unsigned char whitespace_lexer_character_classes [] = 
+{
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0
+};
+
+const int whitespace_lexer_transition_table [] = 
+{
+    -1, 0, 1, 2,
+    0
 };
 
 const LexerStateMachine whitespace_lexer_state_machine = 
@@ -276,7 +419,13 @@ const LexerStateMachine whitespace_lexer_state_machine =
     whitespace_lexer_actions, // actions
     whitespace_lexer_transitions, // transitions
     whitespace_lexer_states, // states
-    &whitespace_lexer_states[0] // start state
+    &whitespace_lexer_states[0], // start state
+    4, // #classes
+    whitespace_lexer_character_classes, // character classes
+    whitespace_lexer_transition_table, // transition table
+    nullptr, // skip symbol
+    1, // #loops
+    whitespace_lexer_loops // loops
 };
 
 const ParserStateMachine parser_state_machine = 
@@ -295,7 +444,14 @@ const ParserStateMachine parser_state_machine =
     &symbols[2], // error symbol
     &states[0], // start state
     &lexer_state_machine, // lexer state machine
-    &whitespace_lexer_state_machine // whitespace lexer state machine
+    &whitespace_lexer_state_machine, // whitespace lexer state machine
+    nullptr, // action table
+    nullptr, // goto table
+    40, // #compressed table entries
+    default_table, // default table
+    base_table, // base table
+    next_table, // next table
+    check_table // check table
 };
 
 }
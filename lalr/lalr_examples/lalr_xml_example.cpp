@@ -1,6 +1,7 @@
 
 #include <lalr/Parser.ipp>
 #include <list>
+#include <utility>
 #include <stdio.h>
 #include <string.h>
 
@@ -45,14 +46,14 @@ struct XmlUserData
     }
     
     XmlUserData( shared_ptr<Attribute> attribute )
-    : attribute_( attribute ),
+    : attribute_( std::move(attribute) ),
       element_()
     {
     }    
     
     XmlUserData( shared_ptr<Element> element )
     : attribute_(),
-      element_( element )
+      element_( std::move(element) )
     {
     }    
 };
@@ -82,40 +83,40 @@ static void string_( const char* begin, const char* end, std::string* lexeme, co
     *lines = 0;
 }
 
-static XmlUserData document( const XmlUserData* start, const ParserNode<char>* nodes, size_t length )
+static XmlUserData document( XmlUserData* start, const ParserNode<char>* nodes, size_t length )
 {
-    const XmlUserData* end = start + length;
+    XmlUserData* end = start + length;
     while ( start != end && !start[0].element_ )
     {
         ++start;
     }    
-    return start != end ? start[0] : XmlUserData();
+    return start != end ? std::move(start[0]) : XmlUserData();
 }
 
-static XmlUserData add_element( const XmlUserData* start, const ParserNode<char>* nodes, size_t length )
+static XmlUserData add_element( XmlUserData* start, const ParserNode<char>* nodes, size_t length )
 {
-    shared_ptr<Element> element = start[0].element_;
-    element->elements_.push_back( start[1].element_ );
-    return XmlUserData( element );
+    shared_ptr<Element> element = std::move( start[0].element_ );
+    element->elements_.push_back( std::move(start[1].element_) );
+    return XmlUserData( std::move(element) );
 }
 
-static XmlUserData create_element( const XmlUserData* start, const ParserNode<char>* nodes, size_t length )
+static XmlUserData create_element( XmlUserData* start, const ParserNode<char>* nodes, size_t length )
 {
     shared_ptr<Element> element( new Element() );
-    element->elements_.push_back( start[0].element_ );
-    return XmlUserData( element );
+    element->elements_.push_back( std::move(start[0].element_) );
+    return XmlUserData( std::move(element) );
 }
 
-static XmlUserData short_element( const XmlUserData* start, const ParserNode<char>* nodes, size_t length )
+static XmlUserData short_element( XmlUserData* start, const ParserNode<char>* nodes, size_t length )
 {
-    shared_ptr<Element> element = start[2].element_;
+    shared_ptr<Element> element = std::move( start[2].element_ );
     element->name_ = nodes[1].lexeme();
-    return XmlUserData( element );
+    return XmlUserData( std::move(element) );
 }
 
-static XmlUserData long_element( const XmlUserData* start, const ParserNode<char>* nodes, size_t length )
+static XmlUserData long_element( XmlUserData* start, const ParserNode<char>* nodes, size_t length )
 {
-    shared_ptr<Element> element = start[2].element_;
+    shared_ptr<Element> element = std::move( start[2].element_ );
     if ( !element )
     {
         element.reset( new Element() );
@@ -124,32 +125,32 @@ static XmlUserData long_element( const XmlUserData* start, const ParserNode<char
     element->name_ = nodes[1].lexeme();
     if ( start[4].element_ )
     {
-        swap( element->elements_, start[4].element_->elements_ );
+        element->elements_ = std::move( start[4].element_->elements_ );
     }
-    return XmlUserData( element );
+    return XmlUserData( std::move(element) );
 }
 
-static XmlUserData add_attribute( const XmlUserData* start, const ParserNode<char>* nodes, size_t length )
+static XmlUserData add_attribute( XmlUserData* start, const ParserNode<char>* nodes, size_t length )
 {
     LALR_ASSERT( start[0].element_ );
-    shared_ptr<Element> element = start[0].element_;
+    shared_ptr<Element> element = std::move( start[0].element_ );
     LALR_ASSERT( start[1].attribute_ );
-    element->attributes_.push_back( start[1].attribute_ );
-    return XmlUserData( element );
+    element->attributes_.push_back( std::move(start[1].attribute_) );
+    return XmlUserData( std::move(element) );
 }
 
-static XmlUserData create_attribute( const XmlUserData* start, const ParserNode<char>* nodes, size_t length )
+static XmlUserData create_attribute( XmlUserData* start, const ParserNode<char>* nodes, size_t length )
 {
     LALR_ASSERT( start[0].attribute_ );
     shared_ptr<Element> element( new Element() );
-    element->attributes_.push_back( start[0].attribute_ );
-    return XmlUserData( element );
+    element->attributes_.push_back( std::move(start[0].attribute_) );
+    return XmlUserData( std::move(element) );
 }
 
-static XmlUserData attribute( const XmlUserData* start, const ParserNode<char>* nodes, size_t length )
+static XmlUserData attribute( XmlUserData* start, const ParserNode<char>* nodes, size_t length )
 {
     shared_ptr<Attribute> attribute( new Attribute(nodes[0].lexeme(), nodes[2].lexeme()) );
-    return XmlUserData( attribute );
+    return XmlUserData( std::move(attribute) );
 }
 
 static void indent( int level )
@@ -7,6 +7,7 @@
 #include <lalr/LexerStateMachine.hpp>
 #include <lalr/LexerState.hpp>
 #include <lalr/LexerTransition.hpp>
+#include <lalr/LexerLoop.hpp>
 #include <lalr/LexerAction.hpp>
 
 using namespace lalr;
@@ -24,6 +25,13 @@ extern const ParserAction actions [];
 extern const ParserSymbol symbols [];
 extern const ParserTransition transitions [];
 extern const ParserState states [];
+extern const int action_table [];
+extern const int goto_table [];
+extern const int default_table [];
+extern const int base_table [];
+extern const int next_table [];
+extern const int check_table [];
+extern const ParserStateMachine parser_state_machine;
 
 const ParserAction actions [] = 
 {
@@ -48,16 +56,16 @@ const ParserSymbol symbols [] =
     {5, "document", "document", (SymbolType) 2},
     {6, "prolog", "prolog", (SymbolType) 2},
     {7, "element", "element", (SymbolType) 2},
-    {8, "lt__backslash__question_xml_terminal", "<\?xml", (SymbolType) 1},
+    {8, "lt__backslash__question_xml_terminal", "<\\?xml", (SymbolType) 1},
     {9, "attributes", "attributes", (SymbolType) 2},
-    {10, "backslash__question__gt_terminal", "\?>", (SymbolType) 1},
+    {10, "backslash__question__gt_terminal", "\\?>", (SymbolType) 1},
     {11, "elements", "elements", (SymbolType) 2},
     {12, "slash__gt_terminal", "/>", (SymbolType) 1},
     {13, "lt__slash_terminal", "</", (SymbolType) 1},
     {14, "attribute", "attribute", (SymbolType) 2},
     {15, "eq_terminal", "=", (SymbolType) 1},
-    {16, "name", "[A-Za-z_:][A-Za-z0-9_:\.-]*", (SymbolType) 1},
-    {17, "value", "[\"']:string:", (SymbolType) 1},
+    {16, "name", "[A-Za-z_:][A-Za-z0-9_:\\.-]*", (SymbolType) 1},
+    {17, "value", "[\\\"']:string:", (SymbolType) 1},
     {-1, nullptr, nullptr, (SymbolType) 0}
 };
 
@@ -66,91 +74,121 @@ const ParserTransition transitions [] =
     {&symbols[3], nullptr, &symbols[6], 0, 0, -1, (TransitionType) 1, 0},
     {&symbols[5], &states[1], nullptr, 0, 0, -1, (TransitionType) 0, 1},
     {&symbols[6], &states[2], nullptr, 0, 0, -1, (TransitionType) 0, 2},
-    {&symbols[8], &states[4], nullptr, 0, 0, -1, (TransitionType) 0, 3},
+    {&symbols[8], &states[3], nullptr, 0, 0, -1, (TransitionType) 0, 3},
     {&symbols[1], nullptr, &symbols[0], 1, 0, -1, (TransitionType) 1, 4},
-    {&symbols[3], &states[11], nullptr, 0, 0, -1, (TransitionType) 0, 5},
-    {&symbols[7], &states[3], nullptr, 0, 0, -1, (TransitionType) 0, 6},
-    {&symbols[1], nullptr, &symbols[5], 2, 0, 0, (TransitionType) 1, 7},
-    {&symbols[9], &states[5], nullptr, 0, 0, -1, (TransitionType) 0, 8},
-    {&symbols[10], nullptr, &symbols[9], 0, 2, -1, (TransitionType) 1, 9},
-    {&symbols[14], &states[19], nullptr, 0, 0, -1, (TransitionType) 0, 10},
-    {&symbols[16], &states[20], nullptr, 0, 0, -1, (TransitionType) 0, 11},
-    {&symbols[10], &states[6], nullptr, 0, 0, -1, (TransitionType) 0, 12},
-    {&symbols[14], &states[18], nullptr, 0, 0, -1, (TransitionType) 0, 13},
-    {&symbols[16], &states[20], nullptr, 0, 0, -1, (TransitionType) 0, 14},
-    {&symbols[3], nullptr, &symbols[6], 3, 0, -1, (TransitionType) 1, 15},
-    {&symbols[3], &states[11], nullptr, 0, 0, -1, (TransitionType) 0, 16},
-    {&symbols[7], &states[10], nullptr, 0, 0, -1, (TransitionType) 0, 17},
-    {&symbols[11], &states[8], nullptr, 0, 0, -1, (TransitionType) 0, 18},
-    {&symbols[13], nullptr, &symbols[11], 0, 1, -1, (TransitionType) 1, 19},
-    {&symbols[3], &states[11], nullptr, 0, 0, -1, (TransitionType) 0, 20},
-    {&symbols[7], &states[9], nullptr, 0, 0, -1, (TransitionType) 0, 21},
-    {&symbols[13], &states[15], nullptr, 0, 0, -1, (TransitionType) 0, 22},
-    {&symbols[3], nullptr, &symbols[11], 2, 0, 1, (TransitionType) 1, 23},
-    {&symbols[13], nullptr, &symbols[11], 2, 0, 1, (TransitionType) 1, 24},
-    {&symbols[3], nullptr, &symbols[11], 1, 0, 2, (TransitionType) 1, 25},
-    {&symbols[13], nullptr, &symbols[11], 1, 0, 2, (TransitionType) 1, 26},
-    {&symbols[16], &states[12], nullptr, 0, 0, -1, (TransitionType) 0, 27},
-    {&symbols[4], nullptr, &symbols[9], 0, 2, -1, (TransitionType) 1, 28},
-    {&symbols[9], &states[13], nullptr, 0, 0, -1, (TransitionType) 0, 29},
-    {&symbols[12], nullptr, &symbols[9], 0, 2, -1, (TransitionType) 1, 30},
-    {&symbols[14], &states[19], nullptr, 0, 0, -1, (TransitionType) 0, 31},
-    {&symbols[16], &states[20], nullptr, 0, 0, -1, (TransitionType) 0, 32},
-    {&symbols[4], &states[7], nullptr, 0, 0, -1, (TransitionType) 0, 33},
-    {&symbols[12], &states[14], nullptr, 0, 0, -1, (TransitionType) 0, 34},
-    {&symbols[14], &states[18], nullptr, 0, 0, -1, (TransitionType) 0, 35},
-    {&symbols[16], &states[20], nullptr, 0, 0, -1, (TransitionType) 0, 36},
-    {&symbols[1], nullptr, &symbols[7], 4, 0, 3, (TransitionType) 1, 37},
-    {&symbols[3], nullptr, &symbols[7], 4, 0, 3, (TransitionType) 1, 38},
-    {&symbols[13], nullptr, &symbols[7], 4, 0, 3, (TransitionType) 1, 39},
-    {&symbols[16], &states[16], nullptr, 0, 0, -1, (TransitionType) 0, 40},
-    {&symbols[4], &states[17], nullptr, 0, 0, -1, (TransitionType) 0, 41},
-    {&symbols[1], nullptr, &symbols[7], 8, 1, 4, (TransitionType) 1, 42},
-    {&symbols[3], nullptr, &symbols[7], 8, 1, 4, (TransitionType) 1, 43},
-    {&symbols[13], nullptr, &symbols[7], 8, 1, 4, (TransitionType) 1, 44},
-    {&symbols[4], nullptr, &symbols[9], 2, 0, 5, (TransitionType) 1, 45},
-    {&symbols[10], nullptr, &symbols[9], 2, 0, 5, (TransitionType) 1, 46},
-    {&symbols[12], nullptr, &symbols[9], 2, 0, 5, (TransitionType) 1, 47},
-    {&symbols[16], nullptr, &symbols[9], 2, 0, 5, (TransitionType) 1, 48},
-    {&symbols[4], nullptr, &symbols[9], 1, 0, 6, (TransitionType) 1, 49},
-    {&symbols[10], nullptr, &symbols[9], 1, 0, 6, (TransitionType) 1, 50},
-    {&symbols[12], nullptr, &symbols[9], 1, 0, 6, (TransitionType) 1, 51},
-    {&symbols[16], nullptr, &symbols[9], 1, 0, 6, (TransitionType) 1, 52},
-    {&symbols[15], &states[21], nullptr, 0, 0, -1, (TransitionType) 0, 53},
-    {&symbols[17], &states[22], nullptr, 0, 0, -1, (TransitionType) 0, 54},
-    {&symbols[4], nullptr, &symbols[14], 3, 0, 7, (TransitionType) 1, 55},
-    {&symbols[10], nullptr, &symbols[14], 3, 0, 7, (TransitionType) 1, 56},
-    {&symbols[12], nullptr, &symbols[14], 3, 0, 7, (TransitionType) 1, 57},
-    {&symbols[16], nullptr, &symbols[14], 3, 0, 7, (TransitionType) 1, 58},
+    {&symbols[3], &states[4], nullptr, 0, 0, -1, (TransitionType) 0, 5},
+    {&symbols[7], &states[5], nullptr, 0, 0, -1, (TransitionType) 0, 6},
+    {&symbols[9], &states[6], nullptr, 0, 0, -1, (TransitionType) 0, 7},
+    {&symbols[10], nullptr, &symbols[9], 0, 2, -1, (TransitionType) 1, 8},
+    {&symbols[14], &states[7], nullptr, 0, 0, -1, (TransitionType) 0, 9},
+    {&symbols[16], &states[8], nullptr, 0, 0, -1, (TransitionType) 0, 10},
+    {&symbols[16], &states[9], nullptr, 0, 0, -1, (TransitionType) 0, 11},
+    {&symbols[1], nullptr, &symbols[5], 2, 0, 0, (TransitionType) 1, 12},
+    {&symbols[10], &states[10], nullptr, 0, 0, -1, (TransitionType) 0, 13},
+    {&symbols[14], &states[11], nullptr, 0, 0, -1, (TransitionType) 0, 14},
+    {&symbols[16], &states[8], nullptr, 0, 0, -1, (TransitionType) 0, 15},
+    {&symbols[4], nullptr, &symbols[9], 1, 0, 6, (TransitionType) 1, 16},
+    {&symbols[10], nullptr, &symbols[9], 1, 0, 6, (TransitionType) 1, 17},
+    {&symbols[12], nullptr, &symbols[9], 1, 0, 6, (TransitionType) 1, 18},
+    {&symbols[16], nullptr, &symbols[9], 1, 0, 6, (TransitionType) 1, 19},
+    {&symbols[15], &states[12], nullptr, 0, 0, -1, (TransitionType) 0, 20},
+    {&symbols[4], nullptr, &symbols[9], 0, 2, -1, (TransitionType) 1, 21},
+    {&symbols[9], &states[13], nullptr, 0, 0, -1, (TransitionType) 0, 22},
+    {&symbols[12], nullptr, &symbols[9], 0, 2, -1, (TransitionType) 1, 23},
+    {&symbols[14], &states[7], nullptr, 0, 0, -1, (TransitionType) 0, 24},
+    {&symbols[16], &states[8], nullptr, 0, 0, -1, (TransitionType) 0, 25},
+    {&symbols[3], nullptr, &symbols[6], 3, 0, -1, (TransitionType) 1, 26},
+    {&symbols[4], nullptr, &symbols[9], 2, 0, 5, (TransitionType) 1, 27},
+    {&symbols[10], nullptr, &symbols[9], 2, 0, 5, (TransitionType) 1, 28},
+    {&symbols[12], nullptr, &symbols[9], 2, 0, 5, (TransitionType) 1, 29},
+    {&symbols[16], nullptr, &symbols[9], 2, 0, 5, (TransitionType) 1, 30},
+    {&symbols[17], &states[14], nullptr, 0, 0, -1, (TransitionType) 0, 31},
+    {&symbols[4], &states[15], nullptr, 0, 0, -1, (TransitionType) 0, 32},
+    {&symbols[12], &states[16], nullptr, 0, 0, -1, (TransitionType) 0, 33},
+    {&symbols[14], &states[11], nullptr, 0, 0, -1, (TransitionType) 0, 34},
+    {&symbols[16], &states[8], nullptr, 0, 0, -1, (TransitionType) 0, 35},
+    {&symbols[4], nullptr, &symbols[14], 3, 0, 7, (TransitionType) 1, 36},
+    {&symbols[10], nullptr, &symbols[14], 3, 0, 7, (TransitionType) 1, 37},
+    {&symbols[12], nullptr, &symbols[14], 3, 0, 7, (TransitionType) 1, 38},
+    {&symbols[16], nullptr, &symbols[14], 3, 0, 7, (TransitionType) 1, 39},
+    {&symbols[3], &states[4], nullptr, 0, 0, -1, (TransitionType) 0, 40},
+    {&symbols[7], &states[17], nullptr, 0, 0, -1, (TransitionType) 0, 41},
+    {&symbols[11], &states[18], nullptr, 0, 0, -1, (TransitionType) 0, 42},
+    {&symbols[13], nullptr, &symbols[11], 0, 1, -1, (TransitionType) 1, 43},
+    {&symbols[1], nullptr, &symbols[7], 4, 0, 3, (TransitionType) 1, 44},
+    {&symbols[3], nullptr, &symbols[7], 4, 0, 3, (TransitionType) 1, 45},
+    {&symbols[13], nullptr, &symbols[7], 4, 0, 3, (TransitionType) 1, 46},
+    {&symbols[3], nullptr, &symbols[11], 1, 0, 2, (TransitionType) 1, 47},
+    {&symbols[13], nullptr, &symbols[11], 1, 0, 2, (TransitionType) 1, 48},
+    {&symbols[3], &states[4], nullptr, 0, 0, -1, (TransitionType) 0, 49},
+    {&symbols[7], &states[19], nullptr, 0, 0, -1, (TransitionType) 0, 50},
+    {&symbols[13], &states[20], nullptr, 0, 0, -1, (TransitionType) 0, 51},
+    {&symbols[3], nullptr, &symbols[11], 2, 0, 1, (TransitionType) 1, 52},
+    {&symbols[13], nullptr, &symbols[11], 2, 0, 1, (TransitionType) 1, 53},
+    {&symbols[16], &states[21], nullptr, 0, 0, -1, (TransitionType) 0, 54},
+    {&symbols[4], &states[22], nullptr, 0, 0, -1, (TransitionType) 0, 55},
+    {&symbols[1], nullptr, &symbols[7], 8, 1, 4, (TransitionType) 1, 56},
+    {&symbols[3], nullptr, &symbols[7], 8, 1, 4, (TransitionType) 1, 57},
+    {&symbols[13], nullptr, &symbols[7], 8, 1, 4, (TransitionType) 1, 58},
     {nullptr, nullptr, nullptr, 0, 0, 0, (TransitionType) 0, -1}
 };
 
 const ParserState states [] = 
 {
-    {0, 4, &transitions[0]},
-    {1, 1, &transitions[4]},
-    {2, 2, &transitions[5]},
-    {3, 1, &transitions[7]},
-    {4, 4, &transitions[8]},
-    {5, 3, &transitions[12]},
-    {6, 1, &transitions[15]},
-    {7, 4, &transitions[16]},
-    {8, 3, &transitions[20]},
-    {9, 2, &transitions[23]},
-    {10, 2, &transitions[25]},
-    {11, 1, &transitions[27]},
-    {12, 5, &transitions[28]},
-    {13, 4, &transitions[33]},
-    {14, 3, &transitions[37]},
-    {15, 1, &transitions[40]},
-    {16, 1, &transitions[41]},
-    {17, 3, &transitions[42]},
-    {18, 4, &transitions[45]},
-    {19, 4, &transitions[49]},
-    {20, 1, &transitions[53]},
-    {21, 1, &transitions[54]},
-    {22, 4, &transitions[55]},
-    {-1, 0, nullptr}
+    {0, 4, &transitions[0], nullptr},
+    {1, 1, &transitions[4], nullptr},
+    {2, 2, &transitions[5], nullptr},
+    {3, 4, &transitions[7], nullptr},
+    {4, 1, &transitions[11], nullptr},
+    {5, 1, &transitions[12], &transitions[12]},
+    {6, 3, &transitions[13], nullptr},
+    {7, 4, &transitions[16], &transitions[16]},
+    {8, 1, &transitions[20], nullptr},
+    {9, 5, &transitions[21], nullptr},
+    {10, 1, &transitions[26], &transitions[26]},
+    {11, 4, &transitions[27], &transitions[27]},
+    {12, 1, &transitions[31], nullptr},
+    {13, 4, &transitions[32], nullptr},
+    {14, 4, &transitions[36], &transitions[36]},
+    {15, 4, &transitions[40], nullptr},
+    {16, 3, &transitions[44], &transitions[44]},
+    {17, 2, &transitions[47], &transitions[47]},
+    {18, 3, &transitions[49], nullptr},
+    {19, 2, &transitions[52], &transitions[52]},
+    {20, 1, &transitions[54], nullptr},
+    {21, 1, &transitions[55], nullptr},
+    {22, 3, &transitions[56], &transitions[56]},
+    {-1, 0, nullptr, nullptr}
+};
+
+const int default_table [] = 
+{
+    0, -1, -1, 8, -1, 12, -1, 16, -1, 21, 26, 27, -1, -1, 36, 43,
+    44, 47, -1, 52, -1, -1, 56,
+    0
+};
+
+const int base_table [] = 
+{
+    0, 0, 23, 1, 5, 0, 8, 0, 8, 11, 0, 0, 11, 0, 0, 0,
+    0, 0, 6, 0, 13, 27, 0,
+    0
+};
+
+const int next_table [] = 
+{
+    -1, 4, -1, 40, 32, 1, 2, 41, 3, 49, 7, 42, 33, 50, 34, 9,
+    35, 10, 13, 51, 22, 11, 14, 20, 15, 24, 5, 25, 31, 54, 6, 55,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    0
+};
+
+const int check_table [] = 
+{
+    -1, 1, -1, 15, 13, 0, 0, 15, 0, 18, 3, 15, 13, 18, 13, 3,
+    13, 3, 6, 18, 9, 4, 6, 8, 6, 9, 2, 9, 12, 20, 2, 21,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    0
 };
 
 const LexerAction lexer_actions [] = 
@@ -163,90 +201,143 @@ const LexerTransition lexer_transitions [] =
 {
     {34, 35, &lexer_states[20], nullptr},
     {39, 40, &lexer_states[20], nullptr},
-    {47, 48, &lexer_states[13], nullptr},
-    {58, 59, &lexer_states[16], nullptr},
+    {47, 48, &lexer_states[14], nullptr},
+    {58, 59, &lexer_states[18], nullptr},
     {60, 61, &lexer_states[6], nullptr},
     {61, 62, &lexer_states[17], nullptr},
-    {62, 63, &lexer_states[11], nullptr},
-    {63, 64, &lexer_states[14], nullptr},
-    {65, 91, &lexer_states[16], nullptr},
-    {95, 96, &lexer_states[16], nullptr},
-    {97, 101, &lexer_states[16], nullptr},
+    {62, 63, &lexer_states[7], nullptr},
+    {63, 64, &lexer_states[12], nullptr},
+    {65, 91, &lexer_states[18], nullptr},
+    {95, 96, &lexer_states[18], nullptr},
+    {97, 101, &lexer_states[18], nullptr},
     {101, 102, &lexer_states[1], nullptr},
-    {102, 123, &lexer_states[16], nullptr},
-    {45, 47, &lexer_states[16], nullptr},
-    {48, 59, &lexer_states[16], nullptr},
-    {65, 91, &lexer_states[16], nullptr},
-    {95, 96, &lexer_states[16], nullptr},
-    {97, 114, &lexer_states[16], nullptr},
+    {102, 123, &lexer_states[18], nullptr},
+    {45, 47, &lexer_states[18], nullptr},
+    {48, 59, &lexer_states[18], nullptr},
+    {65, 91, &lexer_states[18], nullptr},
+    {95, 96, &lexer_states[18], nullptr},
+    {97, 114, &lexer_states[18], nullptr},
     {114, 115, &lexer_states[2], nullptr},
-    {115, 123, &lexer_states[16], nullptr},
-    {45, 47, &lexer_states[16], nullptr},
-    {48, 59, &lexer_states[16], nullptr},
-    {65, 91, &lexer_states[16], nullptr},
-    {95, 96, &lexer_states[16], nullptr},
-    {97, 114, &lexer_states[16], nullptr},
+    {115, 123, &lexer_states[18], nullptr},
+    {45, 47, &lexer_states[18], nullptr},
+    {48, 59, &lexer_states[18], nullptr},
+    {65, 91, &lexer_states[18], nullptr},
+    {95, 96, &lexer_states[18], nullptr},
+    {97, 114, &lexer_states[18], nullptr},
     {114, 115, &lexer_states[3], nullptr},
-    {115, 123, &lexer_states[16], nullptr},
-    {45, 47, &lexer_states[16], nullptr},
-    {48, 59, &lexer_states[16], nullptr},
-    {65, 91, &lexer_states[16], nullptr},
-    {95, 96, &lexer_states[16], nullptr},
-    {97, 111, &lexer_states[16], nullptr},
+    {115, 123, &lexer_states[18], nullptr},
+    {45, 47, &lexer_states[18], nullptr},
+    {48, 59, &lexer_states[18], nullptr},
+    {65, 91, &lexer_states[18], nullptr},
+    {95, 96, &lexer_states[18], nullptr},
+    {97, 111, &lexer_states[18], nullptr},
     {111, 112, &lexer_states[4], nullptr},
-    {112, 123, &lexer_states[16], nullptr},
-    {45, 47, &lexer_states[16], nullptr},
-    {48, 59, &lexer_states[16], nullptr},
-    {65, 91, &lexer_states[16], nullptr},
-    {95, 96, &lexer_states[16], nullptr},
-    {97, 114, &lexer_states[16], nullptr},
+    {112, 123, &lexer_states[18], nullptr},
+    {45, 47, &lexer_states[18], nullptr},
+    {48, 59, &lexer_states[18], nullptr},
+    {65, 91, &lexer_states[18], nullptr},
+    {95, 96, &lexer_states[18], nullptr},
+    {97, 114, &lexer_states[18], nullptr},
     {114, 115, &lexer_states[5], nullptr},
-    {115, 123, &lexer_states[16], nullptr},
-    {45, 47, &lexer_states[16], nullptr},
-    {48, 59, &lexer_states[16], nullptr},
-    {65, 91, &lexer_states[16], nullptr},
-    {95, 96, &lexer_states[16], nullptr},
-    {97, 123, &lexer_states[16], nullptr},
-    {47, 48, &lexer_states[12], nullptr},
-    {63, 64, &lexer_states[10], nullptr},
-    {109, 110, &lexer_states[8], nullptr},
-    {108, 109, &lexer_states[9], nullptr},
-    {120, 121, &lexer_states[7], nullptr},
+    {115, 123, &lexer_states[18], nullptr},
+    {45, 47, &lexer_states[18], nullptr},
+    {48, 59, &lexer_states[18], nullptr},
+    {65, 91, &lexer_states[18], nullptr},
+    {95, 96, &lexer_states[18], nullptr},
+    {97, 123, &lexer_states[18], nullptr},
+    {47, 48, &lexer_states[16], nullptr},
+    {63, 64, &lexer_states[8], nullptr},
+    {120, 121, &lexer_states[9], nullptr},
+    {109, 110, &lexer_states[10], nullptr},
+    {108, 109, &lexer_states[11], nullptr},
+    {62, 63, &lexer_states[13], nullptr},
     {62, 63, &lexer_states[15], nullptr},
-    {62, 63, &lexer_states[18], nullptr},
-    {45, 47, &lexer_states[16], nullptr},
-    {48, 59, &lexer_states[16], nullptr},
-    {65, 91, &lexer_states[16], nullptr},
-    {95, 96, &lexer_states[16], nullptr},
-    {97, 123, &lexer_states[16], nullptr},
+    {45, 47, &lexer_states[18], nullptr},
+    {48, 59, &lexer_states[18], nullptr},
+    {65, 91, &lexer_states[18], nullptr},
+    {95, 96, &lexer_states[18], nullptr},
+    {97, 123, &lexer_states[18], nullptr},
     {0, 2147483647, &lexer_states[19], &lexer_actions[0]},
     {-1, -1, nullptr, nullptr}
 };
 
+const LexerLoop lexer_loops [] = 
+{
+    {{0, 0, 0, 0, 0, 96, 255, 7, 254, 255, 255, 135, 254, 255, 255, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 0, {0, 0, 0, 0, 0, 0, 0, 0}},
+    {{0}, 0, {0}}
+};
+
 const LexerState lexer_states [] = 
 {
-    {0, 13, &lexer_transitions[0], nullptr},
-    {1, 7, &lexer_transitions[13], &symbols[16]},
-    {2, 7, &lexer_transitions[20], &symbols[16]},
-    {3, 7, &lexer_transitions[27], &symbols[16]},
-    {4, 7, &lexer_transitions[34], &symbols[16]},
-    {5, 5, &lexer_transitions[41], &symbols[2]},
-    {6, 2, &lexer_transitions[46], &symbols[3]},
-    {7, 1, &lexer_transitions[48], nullptr},
-    {8, 1, &lexer_transitions[49], nullptr},
-    {9, 0, &lexer_transitions[50], &symbols[8]},
-    {10, 1, &lexer_transitions[50], nullptr},
-    {11, 0, &lexer_transitions[51], &symbols[4]},
-    {12, 0, &lexer_transitions[51], &symbols[13]},
-    {13, 1, &lexer_transitions[51], nullptr},
-    {14, 1, &lexer_transitions[52], nullptr},
-    {15, 0, &lexer_transitions[53], &symbols[12]},
-    {16, 5, &lexer_transitions[53], &symbols[16]},
-    {17, 0, &lexer_transitions[58], &symbols[15]},
-    {18, 0, &lexer_transitions[58], &symbols[10]},
-    {19, 0, &lexer_transitions[58], &symbols[17]},
-    {20, 1, &lexer_transitions[58], nullptr},
-    {-1, 0, nullptr, nullptr}
+    {0, 13, &lexer_transitions[0], nullptr, nullptr},
+    {1, 7, &lexer_transitions[13], &symbols[16], nullptr},
+    {2, 7, &lexer_transitions[20], &symbols[16], nullptr},
+    {3, 7, &lexer_transitions[27], &symbols[16], nullptr},
+    {4, 7, &lexer_transitions[34], &symbols[16], nullptr},
+    {5, 5, &lexer_transitions[41], &symbols[2], nullptr},
+    {6, 2, &lexer_transitions[46], &symbols[3], nullptr},
+    {7, 0, &lexer_transitions[48], &symbols[4], nullptr},
+    {8, 1, &lexer_transitions[48], nullptr, nullptr},
+    {9, 1, &lexer_transitions[49], nullptr, nullptr},
+    {10, 1, &lexer_transitions[50], nullptr, nullptr},
+    {11, 0, &lexer_transitions[51], &symbols[8], nullptr},
+    {12, 1, &lexer_transitions[51], nullptr, nullptr},
+    {13, 0, &lexer_transitions[52], &symbols[10], nullptr},
+    {14, 1, &lexer_transitions[52], nullptr, nullptr},
+    {15, 0, &lexer_transitions[53], &symbols[12], nullptr},
+    {16, 0, &lexer_transitions[53], &symbols[13], nullptr},
+    {17, 0, &lexer_transitions[53], &symbols[15], nullptr},
+    {18, 5, &lexer_transitions[53], &symbols[16], &lexer_loops[0]},
+    {19, 0, &lexer_transitions[58], &symbols[17], nullptr},
+    {20, 1, &lexer_transitions[58], nullptr, nullptr},
+    {-1, 0, nullptr, nullptr, nullptr}
+};
+
+const unsigned char lexer_character_classes [] = 
+{
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 3, 3, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 0, 7, 8, 9, 10,
+    0, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 0, 0, 0, 12,
+    0, 13, 13, 13, 13, 14, 15, 15, 15, 15, 15, 15, 16, 17, 15, 18,
+    19, 19, 20, 21, 21, 21, 21, 21, 22, 21, 21, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0
+};
+
+const int lexer_transition_table [] = 
+{
+    -1, 0, 1, -1, 2, -1, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 12, 12, 12, 12, 12, 12, 12,
+    -1, -1, -1, 13, -1, 14, 14, -1, -1, -1, -1, 15, 16, 17, 17, 17, 17, 17, 17, 17, 18, 19, 19,
+    -1, -1, -1, 20, -1, 21, 21, -1, -1, -1, -1, 22, 23, 24, 24, 24, 24, 24, 24, 24, 25, 26, 26,
+    -1, -1, -1, 27, -1, 28, 28, -1, -1, -1, -1, 29, 30, 31, 31, 31, 31, 31, 32, 33, 33, 33, 33,
+    -1, -1, -1, 34, -1, 35, 35, -1, -1, -1, -1, 36, 37, 38, 38, 38, 38, 38, 38, 38, 39, 40, 40,
+    -1, -1, -1, 41, -1, 42, 42, -1, -1, -1, -1, 43, 44, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+    -1, -1, -1, -1, 46, -1, -1, -1, -1, -1, 47, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 48,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 49, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 50, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 51, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 52, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, 53, -1, 54, 54, -1, -1, -1, -1, 55, 56, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    0
 };
 
 const LexerStateMachine lexer_state_machine = 
@@ -257,7 +348,13 @@ const LexerStateMachine lexer_state_machine =
     lexer_actions, // actions
     lexer_transitions, // transitions
     lexer_states, // states
-    &lexer_states[0] // start state
+    &lexer_states[0], // start state
+    23, // #classes
+    lexer_character_classes, // character classes
+    lexer_transition_table, // transition table
+    nullptr, // skip symbol
+    1, // #loops
+    lexer_loops // loops
 };
 
 const LexerAction whitespace_lexer_actions [] = 
@@ -273,10 +370,43 @@ const LexerTransition whitespace_lexer_transitions [] =
     {-1, -1, nullptr, nullptr}
 };
 
+const LexerLoop whitespace_lexer_loops [] = 
+{
+    {{0, 38, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 3, {9, 10, 13, 13, 32, 32, 0, 0}},
+    {{0}, 0, {0}}
+};
+
 const LexerState whitespace_lexer_states [] = 
 {
-    {0, 3, &whitespace_lexer_transitions[0], nullptr},
-    {-1, 0, nullptr, nullptr}
+    {0, 3, &whitespace_lexer_transitions[0], nullptr, &whitespace_lexer_loops[0]},
+    {-1, 0, nullptr, nullptr, nullptr}
+};
+
+const unsigned char whitespace_lexer_character_classes [] = 
+{
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0
+};
+
+const int whitespace_lexer_transition_table [] = 
+{
+    -1, 0, 1, 2,
+    0
 };
 
 const LexerStateMachine whitespace_lexer_state_machine = 
@@ -287,7 +417,13 @@ const LexerStateMachine whitespace_lexer_state_machine =
     whitespace_lexer_actions, // actions
     whitespace_lexer_transitions, // transitions
     whitespace_lexer_states, // states
-    &whitespace_lexer_states[0] // start state
+    &whitespace_lexer_states[0], // start state
+    4, // #classes
+    whitespace_lexer_character_classes, // character classes
+    whitespace_lexer_transition_table, // transition table
+    nullptr, // skip symbol
+    1, // #loops
+    whitespace_lexer_loops // loops
 };
 
 const ParserStateMachine parser_state_machine = 
@@ -306,7 +442,14 @@ const ParserStateMachine parser_state_machine =
     &symbols[2], // error symbol
     &states[0], // start state
     &lexer_state_machine, // lexer state machine
-    &whitespace_lexer_state_machine // whitespace lexer state machine
+    &whitespace_lexer_state_machine, // whitespace lexer state machine
+    nullptr, // action table
+    nullptr, // goto table
+    45, // #compressed table entries
+    default_table, // default table
+    base_table, // base table
+    next_table, // next table
+    check_table // check table
 };
 
 }
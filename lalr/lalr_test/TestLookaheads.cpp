@@ -0,0 +1,726 @@
+//
+// TestLookaheads.cpp
+// Copyright (c) Charles Baker. All rights reserved.
+//
+
+#include <lalr/ParserStateMachine.hpp>
+#include <lalr/ParserState.hpp>
+#include <lalr/ParserTransition.hpp>
+#include <lalr/ParserSymbol.hpp>
+#include <lalr/LexerStateMachine.hpp>
+#include <lalr/LexerState.hpp>
+#include <lalr/LexerTransition.hpp>
+#include <lalr/LexerAction.hpp>
+#include <lalr/LexerLoop.hpp>
+#include <lalr/GrammarCompiler.hpp>
+#include <UnitTest++/UnitTest++.h>
+#include <string.h>
+
+using namespace lalr;
+
+SUITE( Lookaheads )
+{
+    // The grammars from the other tests and the examples.
+    const char* grammars [] =
+    {
+        "OrOperator {\n"
+        "   unit: one | two | three;\n"
+        "   one: '1';\n"
+        "   two: '2';\n"
+        "   three: '3';\n"
+        "}\n",
+
+        "Alternate {\n"
+        "   unit: one two_three;\n"
+        "   two_three: two | three;\n"
+        "   one: '1';\n"
+        "   two: '2';\n"
+        "   three: '3';\n"
+        "}\n",
+
+        "ZeroToManyRepeats {\n"
+        "   %left two; \n"
+        "   unit: one twos three;\n"
+        "   twos: twos two | two | %precedence two;\n"
+        "   one: '1';\n"
+        "   two: '2';\n"
+        "   three: '3';\n"
+        "}",
+
+        "OneToManyRepeats {\n"
+        "   unit: one twos three;\n"
+        "   twos: twos two | two;\n"
+        "   one: '1';\n"
+        "   two: '2';\n"
+        "   three: '3';\n"
+        "}",
+
+        "Optional {\n"
+        "    unit: one two_opt three;\n"
+        "    two_opt: two | ;\n"
+        "    one: '1';\n"
+        "    two: '2';\n"
+        "    three: '3';\n"
+        "}",
+
+        "Compound {\n"
+        "    compound: one one_two three;\n"
+        "    one_two: one two | two one;\n"
+        "    one: '1';\n"
+        "    two: '2';\n"
+        "    three: '3';\n"
+        "}",
+
+        "BinaryOperator {\n"
+        "    E: E '+' T | T;\n"
+        "    T: T '*' F | F;\n"
+        "    F: '(' E ')' | i;\n"
+        "    i: \"[0-9]+\";\n"
+        "}",
+
+        "NestedProductions {\n"
+        "    %left 'b' 'c';\n"
+        "    A: 'a' bcs 'd';\n"
+        "    bcs: bcs bc | bc | %precedence 'b';\n"
+        "    bc: 'b' 'c';\n"
+        "}",
+
+        "FollowGeneration {\n"
+        "    unit: one two four | one three four;\n"
+        "    one: '1';\n"
+        "    two: '2';\n"
+        "    three: '3';\n"
+        "    four: '4';\n"
+        "}",
+
+        "Canonical {\n"
+        "    S: C C;\n"
+        "    C: 'c' C | 'd';\n"
+        "}",
+
+        "MultipleDotNodesParser {\n"
+        "    unit: lt | lt question;\n"
+        "    lt: '<';\n"
+        "    question: '?';\n"
+        "}",
+
+        "ProductionsOnCollapsedSymbols {\n"
+        "    unit: 'a' [unit];\n"
+        "}",
+
+        "ReduceStarNode {\n"
+        "   %left one;\n"
+        "   unit: ones;\n"
+        "   ones: ones one | one | %precedence one;\n"
+        "   one: '1';\n"
+        "}",
+
+        "ReduceParenthesis {\n"
+        "    expr: '(' expr ')' | '1';\n"
+        "}",
+
+        "ReduceStarAndParenthesis {\n"
+        "   %left '(' '1';\n"
+        "   expr: '(' exprs ')' | '1';\n"
+        "   exprs: exprs expr | expr | %precedence '(';\n"
+        "}",
+
+        "Whitespace {\n"
+        "   %whitespace \"[ \\t\\r\\n]*\";\n"
+        "   unit: identifiers;\n"
+        "   identifiers: identifiers identifier\n"
+        "              | identifier\n"
+        "              ;\n"
+        "   identifier: \"[A-Za-z_][A-Za-z_0-9]*\";\n"
+        "}",
+
+        "String { \n"
+        "   %whitespace \"[ \\t\\r\\n]*\";\n"
+        "   unit: strings;\n"
+        "   strings: strings string | string;\n"
+        "   string: \"':string:\";\n"
+        "}",
+
+        "LineComment {\n"
+        "   %whitespace \"([ \\t\\r\\n]|\\/\\/:line_comment:)*\";\n"
+        "   unit: digits;\n"
+        "   digits: digits digit | digit;\n"
+        "   digit: \"[0-9]\";\n"
+        "}",
+
+        "BlockComment {\n"
+        "   %whitespace \"([ \\t\\r\\n]|\\/\\*:block_comment:)*\";\n"
+        "   unit: digits;\n"
+        "   digits: digits digit | digit;\n"
+        "   digit: \"[0-9]\";\n"
+        "}",
+
+        "MissingCloseQuotes { \n"
+        "   %whitespace \"[ \\t\\r\\n]*;\n"
+        "   unit: strings;\n"
+        "   strings: strings string | string;\n"
+        "   string: \"':string:';\n"
+        "}",
+
+        "SyntaxErrorsInRegularExpressions {\n"
+        "   %whitespace \"[ \\t\\r\\n*\";\n"
+        "   one: \"[A-z*\";\n"
+        "}",
+
+        "UndefinedSymbolError {\n"
+        "   %whitespace \"[ \\t\\r\\n]*\";\n"
+        "   one: undefined_symbol;\n"
+        "}",
+
+        "UnreferencedSymbolError {\n"
+        "   one: 'one';\n"
+        "   unreferenced_symbol: 'two';\n"
+        "}",
+
+        "SymbolsOnlyAppearingInPrecedenceDirectivesAreCountedAsReferenced { \n"
+        "   %left unary_minus; \n"
+        "   %left '+' '-'; \n"
+        "   %left '/' '*'; \n"
+        " \n"
+        "   expression: expression '/' expression \n"
+        "             | expression '*' expression \n"
+        "             | expression '+' expression \n"
+        "             | expression '-' expression \n"
+        "             | '-' expression %precedence unary_minus \n"
+        "             | integer \n"
+        "             ; \n"
+        " \n"
+        " integer: \"[0-9]+\"; \n"
+        "}",
+
+        "LexerConflictError {\n"
+        "   %whitespace \"[ \\t\\r\\n]*\";\n"
+        "   %left prototype value;\n"
+        "   target: prototype '{' targets '}';\n"
+        "   targets: targets target | targets value | target | value | %precedence prototype;\n"
+        "   prototype: \"[A-Za-z_][A-Za-z_0-9]*\"; value: \"[A-Za-z_0-9\\./@:-]+\";\n"
+        "}",
+
+        "LexerSymbolConflictResolvedByAction {\n"
+        "   %whitespace \"[ \\t\\r\\n]*\";\n"
+        "   %left prototype value;\n"
+        "   target: prototype '{' targets '}';\n"
+        "   targets: targets target | targets value | target | value | %precedence prototype;\n"
+        "   prototype: \"[A-Za-z_][A-Za-z0-9_]*:prototype:\";\n"
+        "   value: \"[A-Za-z0-9_\\./@:-]+\";\n"
+        "}",
+
+        "AssociativityDirectives {\n"
+        "   %left '+' '-';\n"
+        "   %left '*' '/';\n"
+        "   %none integer;\n"
+        "   unit: expr;\n"
+        "   expr: expr '+' expr | expr '-' expr | expr '*' expr | expr '/' expr | integer;\n"
+        "   integer: \"[0-9]+\";\n"
+        "}",
+
+        "PrecedenceDirectives {\n"
+        "   %left '+';\n"
+        "   %left '-';\n"
+        "   %none integer;\n"
+        "   unit: expr;\n"
+        "   expr: expr '+' expr %precedence '-' [first]\n"
+        "       | expr '-' expr %precedence '+' [second]\n"
+        "       | integer\n"
+        "       ;\n"
+        "   integer: \"[0-9]+\";\n"
+        "}",
+
+        "ErrorSymbolOnLeftHandSideError {\n"
+        "   %whitespace \"[ \\t\\r\\n]*\";\n"
+        "   unit: prototype '{' error '}';\n"
+        "   prototype: \"[A-Za-z_][A-Za-z_0-9]*\";\n"
+        "   error: ;\n"
+        "}",
+
+        "ErrorProcessing {"
+        "   %left error;\n"
+        "   %left '+';\n"
+        "   expr: expr '+' expr [add] | expr error expr [error] | integer;\n"
+        "   integer: \"[0-9]+\";\n"
+        "}",
+
+        "EmptyProduction { \n"
+        "   %left integer; \n"
+        "   unit: statements; \n"
+        "   statements: statements statement | statement %precedence integer | %precedence integer; \n"
+        "   statement: integer ';'; \n"
+        "   integer: \"[0-9]+\"; \n"
+        "}",
+
+        "// Line comment LF \n"
+        "// Line comment ending with CR \r"
+        "// Line comment LF CR \n\r"
+        "// Line comment CR LF \r\n"
+        "LineComment { \n"
+        "   unit: line_comment_example; \n"
+        "   line_comment_example: 'LineCommentExample'; // Line comment at the end of a valid line \n"
+        "} \n"
+        "// Unterminated line comment",
+
+        "/* Block comment before grammar... \n"
+        "...that spans several lines... \n"
+        "*/ \n"
+        "BlockComment /* Block comment between tokens */ { \n"
+        "   unit: block_comment_example; /* Block comment at the end of a line */ \n"
+        "   block_comment_example: /* Another block comment between tokens */ 'BlockCommentExample'; // Line comment at the end of a valid line \n"
+        "} \n"
+        "/* Block comment at the end of input */",
+
+        "BlockComment { \n"
+        "   unit: 'BlockCommentExample'; \n"
+        "} \n"
+        "/* Unterminated block comment... \n",
+
+        "integers { \n"
+        "   %none error; \n"
+        "   %none integer; \n"
+        "   statements: statements statement | statement | %precedence integer; \n"
+        "   statement:  \n"
+        "       integer ';' [result] |  \n"
+        "       error ';' [unexpected_error] \n"
+        "   ; \n"
+        "   integer: \"[0-9]+\"; \n"
+        "} \n",
+
+        "line_numbering { \n"
+        "   %whitespace \"[ \\t\\n\\r]*\";"
+        "   %none error; \n"
+        "   %none integer; \n"
+        "   statements: statements statement | statement | %precedence integer; \n"
+        "   statement:  \n"
+        "       integer ';' [result] |  \n"
+        "       error ';' [unexpected_error] \n"
+        "   ; \n"
+        "   integer: \"[0-9]+\"; \n"
+        "} \n",
+
+        "ActionAndGotoTables {\n"
+        "   %whitespace \"[ \\t\\r\\n]*\";\n"
+        "   %left '+';\n"
+        "   %left '*';\n"
+        "   unit: expr;\n"
+        "   expr: expr '+' expr | expr '*' expr | '(' expr ')' | integer;\n"
+        "   integer: \"[0-9]+\";\n"
+        "}",
+
+        "CompressedTables {\n"
+        "   %whitespace \"[ \\t\\r\\n]*\";\n"
+        "   %left '+';\n"
+        "   %left '*';\n"
+        "   unit: expr [result];\n"
+        "   expr: expr '+' expr [add] | expr '*' expr [multiply] | '(' expr ')' [compound] | integer [integer];\n"
+        "   integer: \"[0-9]+\";\n"
+        "}",
+
+        "DefaultReductions {\n"
+        "   %whitespace \"[ \\t\\r\\n]*\";\n"
+        "   values: values value | value;\n"
+        "   value: 'null' [null] | integer [integer];\n"
+        "   integer: \"[0-9]+\";\n"
+        "}",
+
+        "ZeroCopyLexemes {\n"
+        "   %whitespace \"[ \\t\\r\\n]*\";\n"
+        "   unit: values;\n"
+        "   values: values value | value;\n"
+        "   value: identifier [identifier] | string [string];\n"
+        "   identifier: \"[A-Za-z_]+\";\n"
+        "   string: \"':string:\";\n"
+        "}",
+
+        "FoldedWhitespace {\n"
+        "   %whitespace \"[ \\t\\r\\n]*\";\n"
+        "   unit: identifiers;\n"
+        "   identifiers: identifiers identifier | identifier;\n"
+        "   identifier: \"[A-Za-z_]+\" [identifier];\n"
+        "}",
+
+        "LazyPositions { \n"
+        "   %whitespace \"[ \\t\\n\\r]*\";"
+        "   %none error; \n"
+        "   %none integer; \n"
+        "   statements: statements statement | statement | %precedence integer; \n"
+        "   statement:  \n"
+        "       integer ';' [result] |  \n"
+        "       error ';' [unexpected_error] \n"
+        "   ; \n"
+        "   integer: \"[0-9]+\"; \n"
+        "} \n",
+
+        "StreamedInput {\n"
+        "   %whitespace \"([ \\t\\r\\n]|#[^\\n]*\\n)*\";\n"
+        "   unit: items;\n"
+        "   items: items item | item;\n"
+        "   item: identifier [item] | integer [item] | '==' [item] | '=' [item];\n"
+        "   identifier: \"[A-Za-z_][A-Za-z0-9_]*\";\n"
+        "   integer: \"[0-9]+\";\n"
+        "}",
+
+        "ParseFile {\n"
+        "   %whitespace \"[ \\t\\r\\n]*\";\n"
+        "   unit: identifiers;\n"
+        "   identifiers: identifiers identifier | identifier;\n"
+        "   identifier: \"[A-Za-z_]+\" [identifier];\n"
+        "}",
+
+        "BatchParsing {\n"
+        "   %whitespace \"[ \\t\\r\\n]*\";\n"
+        "   %left '+';\n"
+        "   expr: expr '+' expr [add] | integer [integer];\n"
+        "   integer: \"[0-9]+\";\n"
+        "}",
+
+        "ParserTreeNodes {\n"
+        "   %whitespace \"[ \\t\\r\\n]*\";\n"
+        "   list: '(' items ')' [list];\n"
+        "   items: items ',' item | item | ;\n"
+        "   item: name | list;\n"
+        "   name: \"[a-z]+\";\n"
+        "}",
+
+        "EventParsing {\n"
+        "   %whitespace \"[ \\t\\r\\n]*\";\n"
+        "   list: '(' items ')' [list];\n"
+        "   items: items ',' item | item | ;\n"
+        "   item: name | list;\n"
+        "   name: \"[a-z]+\";\n"
+        "}",
+
+        "RecognizeOnly { \n"
+        "   %whitespace \"[ \\t\\n\\r]*\";"
+        "   %none error; \n"
+        "   %none integer; \n"
+        "   statements: statements statement | statement | %precedence integer; \n"
+        "   statement:  \n"
+        "       integer ';' [result] |  \n"
+        "       error ';' [unexpected_error] \n"
+        "   ; \n"
+        "   integer: \"[0-9]+\"; \n"
+        "} \n",
+
+        "CompactStack {\n"
+        "   %whitespace \"[ \\t\\r\\n]*\";\n"
+        "   list: '[' contents ']' [list];\n"
+        "   contents: contents ',' content [add] | content [create];\n"
+        "   content: integer [content] | list [content];\n"
+        "   integer: \"[0-9]+\";\n"
+        "}",
+
+        "MoveOnlyUserData {\n"
+        "   %whitespace \"[ \\t\\r\\n]*\";\n"
+        "   list: '[' integers ']' [list];\n"
+        "   integers: integers ',' integer [add] | integer [create];\n"
+        "   integer: \"[0-9]+\";\n"
+        "}",
+
+        "StaticParsing {\n"
+        "   %left '+';\n"
+        "   %whitespace \"[ \\t\\r\\n]*\";\n"
+        "   expr: expr '+' expr [add] | integer [integer] | '(' expr ')';\n"
+        "   integer: \"[0-9]+\";\n"
+        "}",
+
+        "precedence_grammar { \n"
+        "   %whitespace \"[ \\t\\r\\n]*\"; \n"
+        "   %left '+' '-'; \n"
+        "   %left '*' '/'; \n"
+        "   %none integer; \n"
+        "   unit: expr; \n"
+        "   expr: \n"
+        "       expr '+' expr | \n"
+        "       expr '-' expr | \n"
+        "       expr '*' expr | \n"
+        "       expr '/' expr | \n"
+        "       integer \n"
+        "   ; \n"
+        "   integer: \"[0-9]+\"; \n"
+        "} \n",
+
+        "missing_footer { \n"
+        "   %left 'int' 'float' 'void'; \n",
+
+        "unterminated_directive_literals { \n"
+        "%left 'int' float' 'void'; \n"
+        "%left 'return' 'break' 'continue' 'if' 'while' 'for' identifier '{'; \n"
+        "} \n",
+
+        // Lookaheads read through and included across nullable symbols.
+        "NullableLookaheads {\n"
+        "   statements: statements statement | ;\n"
+        "   statement: expression modifiers terminator;\n"
+        "   modifiers: modifiers modifier | ;\n"
+        "   modifier: 'const' | 'static';\n"
+        "   terminator: ';' | ;\n"
+        "   expression: expression '+' term | term;\n"
+        "   term: 'x' | '(' expression ')';\n"
+        "}\n",
+
+        // lalr_examples/error_handling_calculator.g
+        "error_handling_calculator {\n"
+        "    %whitespace \"[ \\t\\r\\n]*\";\n"
+        "    %none error;\n"
+        "    %left '(' ')';\n"
+        "    %left '+' '-';\n"
+        "    %left '*' '/';\n"
+        "    %none integer;\n"
+        "    stmts: stmts stmt | stmt | %precedence '(';\n"
+        "    stmt: \n"
+        "        expr ';' [result] | \n"
+        "        error ';' [unexpected_error]\n"
+        "    ;\n"
+        "    expr:\n"
+        "        expr '+' expr [add] |\n"
+        "        expr '-' expr [subtract] |\n"
+        "        expr '*' expr [multiply] |\n"
+        "        expr '/' expr [divide] |\n"
+        "        expr error expr [unknown_operator_error] |\n"
+        "        '(' expr ')' [compound] |\n"
+        "        integer [integer]\n"
+        "    ;\n"
+        "    integer: \"[0-9]+\";\n"
+        "}\n",
+
+        // lalr_examples/json.g
+        "json {\n"
+        "   %whitespace \"[ \\t\\r\\n]*\";\n"
+        "   document: '{' element '}' [document];\n"
+        "   element: name ':' '{' contents '}' [element];\n"
+        "   contents: contents ',' content [add_to_element] | content [create_element];\n"
+        "   content: attribute [content] | element [content];\n"
+        "   attribute: name ':' value [attribute];\n"
+        "   value: 'null' [value] | 'true' [value] | 'false' [value] | integer [value] | real [value] | string [value];\n"
+        "   name: \"[\\\"']:string:\";\n"
+        "   integer: \"(\\+|\\-)?[0-9]+\";\n"
+        "   real: \"(\\+|\\-)?[0-9]+(\\.[0-9]+)?((e|E)(\\+|\\-)?[0-9]+)?\";\n"
+        "   string: \"[\\\"']:string:\";\n"
+        "}\n",
+
+        // lalr_examples/xml.g
+        "xml {\n"
+        "   %whitespace \"[ \\t\\r\\n]*\";\n"
+        "   %left '<' '>';\n"
+        "   %left name;\n"
+        "   document: prolog element [document];\n"
+        "   prolog: \"<\\?xml\" attributes \"\\?>\" | ;\n"
+        "   elements: elements element [add_element] | element [create_element] | %precedence '<';\n"
+        "   element: '<' name attributes '/>' [short_element] | '<' name attributes '>' elements '</' name '>' [long_element];\n"
+        "   attributes: attributes attribute [add_attribute] | attribute [create_attribute] | %precedence name;\n"
+        "   attribute: name '=' value [attribute];\n"
+        "   name: \"[A-Za-z_:][A-Za-z0-9_:\\.-]*\";\n"
+        "   value: \"[\\\"']:string:\";\n"
+        "}\n",
+    };
+
+    int index_of( const ParserSymbol* symbol )
+    {
+        return symbol ? symbol->index : -1;
+    }
+
+    int index_of( const ParserState* state )
+    {
+        return state ? state->index : -1;
+    }
+
+    int index_of( const ParserTransition* transition )
+    {
+        return transition ? transition->index : -1;
+    }
+
+    int index_of( const LexerState* state )
+    {
+        return state ? state->index : -1;
+    }
+
+    int index_of( const LexerAction* action )
+    {
+        return action ? action->index : -1;
+    }
+
+    int index_of( const void* symbol, const ParserStateMachine* state_machine )
+    {
+        if ( symbol == state_machine )
+        {
+            return -2;
+        }
+        for ( int i = 0; i < state_machine->symbols_size; ++i )
+        {
+            if ( symbol == &state_machine->symbols[i] )
+            {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    void check_same_lexer( const LexerStateMachine* lexer, const ParserStateMachine* state_machine, const LexerStateMachine* other_lexer, const ParserStateMachine* other_state_machine )
+    {
+        CHECK_EQUAL( lexer != nullptr, other_lexer != nullptr );
+        if ( !lexer || !other_lexer )
+        {
+            return;
+        }
+
+        CHECK_EQUAL( lexer->actions_size, other_lexer->actions_size );
+        CHECK_EQUAL( lexer->transitions_size, other_lexer->transitions_size );
+        CHECK_EQUAL( lexer->states_size, other_lexer->states_size );
+        CHECK_EQUAL( lexer->classes_size, other_lexer->classes_size );
+        CHECK_EQUAL( lexer->loops_size, other_lexer->loops_size );
+        CHECK_EQUAL( index_of(lexer->start_state), index_of(other_lexer->start_state) );
+        CHECK_EQUAL( index_of(lexer->skip_symbol, state_machine), index_of(other_lexer->skip_symbol, other_state_machine) );
+        if ( lexer->transitions_size != other_lexer->transitions_size || lexer->states_size != other_lexer->states_size || lexer->classes_size != other_lexer->classes_size || lexer->loops_size != other_lexer->loops_size )
+        {
+            return;
+        }
+
+        for ( int i = 0; i < lexer->states_size; ++i )
+        {
+            const LexerState* state = &lexer->states[i];
+            const LexerState* other_state = &other_lexer->states[i];
+            CHECK_EQUAL( state->index, other_state->index );
+            CHECK_EQUAL( state->length, other_state->length );
+            CHECK_EQUAL( state->transitions - lexer->transitions, other_state->transitions - other_lexer->transitions );
+            CHECK_EQUAL( index_of(state->symbol, state_machine), index_of(other_state->symbol, other_state_machine) );
+            CHECK_EQUAL( state->loop ? state->loop - lexer->loops : -1, other_state->loop ? other_state->loop - other_lexer->loops : -1 );
+        }
+        for ( int i = 0; i < lexer->transitions_size; ++i )
+        {
+            const LexerTransition* transition = &lexer->transitions[i];
+            const LexerTransition* other_transition = &other_lexer->transitions[i];
+            CHECK_EQUAL( transition->begin, other_transition->begin );
+            CHECK_EQUAL( transition->end, other_transition->end );
+            CHECK_EQUAL( index_of(transition->state), index_of(other_transition->state) );
+            CHECK_EQUAL( index_of(transition->action), index_of(other_transition->action) );
+        }
+        for ( int i = 0; i < lexer->loops_size; ++i )
+        {
+            CHECK( memcmp(&lexer->loops[i], &other_lexer->loops[i], sizeof(LexerLoop)) == 0 );
+        }
+        CHECK_EQUAL( lexer->character_classes != nullptr, other_lexer->character_classes != nullptr );
+        if ( lexer->character_classes && other_lexer->character_classes )
+        {
+            CHECK( memcmp(lexer->character_classes, other_lexer->character_classes, 256) == 0 );
+        }
+        CHECK_EQUAL( lexer->transition_table != nullptr, other_lexer->transition_table != nullptr );
+        if ( lexer->transition_table && other_lexer->transition_table )
+        {
+            CHECK( memcmp(lexer->transition_table, other_lexer->transition_table, sizeof(int) * lexer->states_size * lexer->classes_size) == 0 );
+        }
+    }
+
+    void check_same_transitions( const ParserStateMachine* state_machine, const ParserStateMachine* other_state_machine )
+    {
+        CHECK_EQUAL( state_machine->states_size, other_state_machine->states_size );
+        CHECK_EQUAL( state_machine->transitions_size, other_state_machine->transitions_size );
+        if ( state_machine->states_size == other_state_machine->states_size && state_machine->transitions_size == other_state_machine->transitions_size )
+        {
+            for ( int i = 0; i < state_machine->states_size; ++i )
+            {
+                const ParserState* state = &state_machine->states[i];
+                const ParserState* other_state = &other_state_machine->states[i];
+                CHECK_EQUAL( state->length, other_state->length );
+                CHECK_EQUAL( index_of(state->default_transition), index_of(other_state->default_transition) );
+            }
+            for ( int i = 0; i < state_machine->transitions_size; ++i )
+            {
+                const ParserTransition* transition = &state_machine->transitions[i];
+                const ParserTransition* other_transition = &other_state_machine->transitions[i];
+                CHECK_EQUAL( index_of(transition->symbol), index_of(other_transition->symbol) );
+                CHECK_EQUAL( index_of(transition->state), index_of(other_transition->state) );
+                CHECK_EQUAL( index_of(transition->reduced_symbol), index_of(other_transition->reduced_symbol) );
+                CHECK_EQUAL( transition->reduced_length, other_transition->reduced_length );
+                CHECK_EQUAL( transition->precedence, other_transition->precedence );
+                CHECK_EQUAL( transition->action, other_transition->action );
+                CHECK_EQUAL( int(transition->type), int(other_transition->type) );
+                CHECK_EQUAL( transition->index, other_transition->index );
+            }
+        }
+    }
+
+    TEST( RelationsGenerateSameTransitionsAsPropagation )
+    {
+        for ( size_t i = 0; i < sizeof(grammars) / sizeof(grammars[0]); ++i )
+        {
+            const char* grammar = grammars[i];
+
+            GrammarCompiler propagation_compiler;
+            propagation_compiler.set_lookahead_relations_enabled( false );
+            int propagation_errors = propagation_compiler.compile( grammar, grammar + strlen(grammar) );
+
+            GrammarCompiler relations_compiler;
+            CHECK( relations_compiler.is_lookahead_relations_enabled() );
+            int relations_errors = relations_compiler.compile( grammar, grammar + strlen(grammar) );
+
+            CHECK_EQUAL( propagation_errors, relations_errors );
+            check_same_transitions( propagation_compiler.parser_state_machine(), relations_compiler.parser_state_machine() );
+        }
+    }
+
+    TEST( StatesAreNumberedInBreadthFirstOrder )
+    {
+        const char* grammar = 
+            "BinaryOperator {\n"
+            "    E: E '+' T | T;\n"
+            "    T: T '*' F | F;\n"
+            "    F: '(' E ')' | i;\n"
+            "    i: \"[0-9]+\";\n"
+            "}"
+        ;
+
+        GrammarCompiler compiler;
+        int errors = compiler.compile( grammar, grammar + strlen(grammar) );
+        CHECK_EQUAL( 0, errors );
+        const ParserStateMachine* state_machine = compiler.parser_state_machine();
+        CHECK_EQUAL( 0, index_of(state_machine->start_state) );
+
+        int next_state = 1;
+        for ( int i = 0; i < state_machine->states_size; ++i )
+        {
+            const ParserState* state = &state_machine->states[i];
+            for ( int j = 0; j < state->length; ++j )
+            {
+                int state_transitioned_to = index_of( state->transitions[j].state );
+                CHECK( state_transitioned_to <= next_state );
+                if ( state_transitioned_to == next_state )
+                {
+                    ++next_state;
+                }
+            }
+        }
+        CHECK_EQUAL( state_machine->states_size, next_state );
+    }
+
+    TEST( ThreadsGenerateSameStateMachinesAsOneThread )
+    {
+        for ( size_t i = 0; i < sizeof(grammars) / sizeof(grammars[0]); ++i )
+        {
+            const char* grammar = grammars[i];
+
+            for ( int fold_whitespace = 0; fold_whitespace < 2; ++fold_whitespace )
+            {
+                GrammarCompiler compiler;
+                compiler.set_whitespace_folding_enabled( fold_whitespace != 0 );
+                int errors = compiler.compile( grammar, grammar + strlen(grammar) );
+
+                GrammarCompiler threads_compiler;
+                threads_compiler.set_whitespace_folding_enabled( fold_whitespace != 0 );
+                int threads_errors = threads_compiler.compile( grammar, grammar + strlen(grammar), nullptr, 4 );
+
+                CHECK_EQUAL( errors, threads_errors );
+                const ParserStateMachine* state_machine = compiler.parser_state_machine();
+                const ParserStateMachine* threads_state_machine = threads_compiler.parser_state_machine();
+                check_same_transitions( state_machine, threads_state_machine );
+                if ( errors == 0 && threads_errors == 0 )
+                {
+                    check_same_lexer( state_machine->lexer_state_machine, state_machine, threads_state_machine->lexer_state_machine, threads_state_machine );
+                    check_same_lexer( state_machine->whitespace_lexer_state_machine, state_machine, threads_state_machine->whitespace_lexer_state_machine, threads_state_machine );
+                }
+            }
+        }
+    }
+}
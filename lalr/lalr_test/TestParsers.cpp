@@ -4,18 +4,47 @@
 //
 
 #include <lalr/Parser.ipp>
+#include <lalr/BatchParser.ipp>
+#include <lalr/ParserTree.ipp>
+#include <lalr/EventParser.ipp>
+#include <lalr/Recognizer.ipp>
+#include <lalr/StaticParser.ipp>
 #include <lalr/ParserStateMachine.hpp>
 #include <lalr/ErrorCode.hpp>
 #include <lalr/GrammarCompiler.hpp>
 #include <lalr/ErrorPolicy.hpp>
 #include <functional>
+#include <string>
 #include <UnitTest++/UnitTest++.h>
+#include "static_parsing_actions.hpp"
 #include <string.h>
 
 using std::bind;
 using namespace std::placeholders;
 using namespace lalr;
 
+namespace
+{
+
+struct StaticParsingHandler
+{
+    int reductions;
+
+    int add( int* data, const ParserNode<>* /*nodes*/, size_t /*length*/ )
+    {
+        ++reductions;
+        return data[0] + data[2];
+    }
+
+    int integer( int* /*data*/, const ParserNode<>* nodes, size_t /*length*/ )
+    {
+        ++reductions;
+        return atoi( nodes[0].lexeme().c_str() );
+    }
+};
+
+}
+
 SUITE( Parsers )
 {
     static const ParserSymbol* find_symbol_by_identifier( const ParserStateMachine* parser_state_machine, const char* identifier )
@@ -928,6 +957,58 @@ SUITE( Parsers )
         CHECK( error_policy.errors == 2 );
     }
 
+    TEST( CompileOnMultipleThreads )
+    {
+        const char* whitespace_grammar =
+            "Whitespace {\n"
+            "   %whitespace \"[ \\t\\r\\n]*\";\n"
+            "   unit: identifiers;\n"
+            "   identifiers: identifiers identifier\n"
+            "              | identifier\n"
+            "              ;\n"
+            "   identifier: \"[A-Za-z_][A-Za-z_0-9]*\";\n"
+            "}"
+        ;
+
+        GrammarCompiler compiler;
+        int errors = compiler.compile( whitespace_grammar, whitespace_grammar + strlen(whitespace_grammar), nullptr, 4 );
+        CHECK_EQUAL( 0, errors );
+        CHECK( compiler.parser_state_machine()->lexer_state_machine );
+        CHECK( compiler.parser_state_machine()->whitespace_lexer_state_machine );
+        CHECK( compiler.parse_time() >= 0.0 );
+        CHECK( compiler.symbols_time() >= 0.0 );
+        CHECK( compiler.parser_time() >= 0.0 );
+        CHECK( compiler.lexer_time() >= 0.0 );
+        CHECK( compiler.whitespace_lexer_time() >= 0.0 );
+        CHECK( compiler.compile_time() >= compiler.parse_time() + compiler.symbols_time() + compiler.parser_time() );
+
+        Parser<const char*> parser( compiler.parser_state_machine() );
+        const char* input = "abc \t\r def";
+        parser.parse( input, input + strlen(input) );
+        CHECK( parser.accepted() );
+        CHECK( parser.full() );
+    }
+
+    TEST( LexerErrorsReportedWhenCompilingOnMultipleThreads )
+    {
+        const char* syntax_errors_in_regular_expressions_grammar = 
+            "SyntaxErrorsInRegularExpressions {\n"
+            "   %whitespace \"[ \\t\\r\\n*\";\n"
+            "   one: \"[A-z*\";\n"
+            "}"
+        ;
+
+        CheckLexerErrorPolicy error_policy( LEXER_ERROR_SYNTAX );
+        GrammarCompiler compiler;
+        compiler.compile( 
+            syntax_errors_in_regular_expressions_grammar, 
+            syntax_errors_in_regular_expressions_grammar + strlen(syntax_errors_in_regular_expressions_grammar),
+            &error_policy,
+            4
+        );
+        CHECK( error_policy.errors == 2 );
+    }
+
     TEST( UndefinedSymbolError )
     {
         const char* undefined_symbol_grammar = 
@@ -1144,6 +1225,26 @@ SUITE( Parsers )
         compiler.compile( grammar, grammar + strlen(grammar), &error_policy );
         CHECK( error_policy.errors == 1 );             
     }
+
+    TEST( TooManyStatesError )
+    {
+        // Each symbol in a production of 65536 symbols needs its own state
+        // which is more than a Parser can index.
+        std::string grammar = "TooManyStatesError {\n   unit:";
+        for ( int i = 0; i < ParserStateMachine::MAXIMUM_STATES; ++i )
+        {
+            grammar += " 'x'";
+        }
+        grammar += ";\n}";
+
+        GrammarCompiler compiler;
+        CheckParserErrorPolicy error_policy( PARSER_ERROR_TOO_MANY_STATES );
+        int errors = compiler.compile( grammar.c_str(), grammar.c_str() + grammar.size(), &error_policy );
+        CHECK( errors == 1 );
+        CHECK( error_policy.errors == 1 );
+        CHECK( compiler.parser_state_machine()->states_size == 0 );
+        CHECK( !compiler.parser_state_machine()->start_state );
+    }
         
     TEST( ErrorProcessing )
     {
@@ -1324,4 +1425,941 @@ SUITE( Parsers )
         CHECK( parser.accepted() );
         CHECK( parser.full() );        
     }
+
+    TEST( ActionAndGotoTables )
+    {
+        const char* tables_grammar =
+            "ActionAndGotoTables {\n"
+            "   %whitespace \"[ \\t\\r\\n]*\";\n"
+            "   %left '+';\n"
+            "   %left '*';\n"
+            "   unit: expr;\n"
+            "   expr: expr '+' expr | expr '*' expr | '(' expr ')' | integer;\n"
+            "   integer: \"[0-9]+\";\n"
+            "}"
+        ;
+
+        GrammarCompiler compiler;
+        compiler.compile( tables_grammar, tables_grammar + strlen(tables_grammar) );
+        const ParserStateMachine* state_machine = compiler.parser_state_machine();
+        CHECK( state_machine->action_table );
+        CHECK( state_machine->goto_table );
+
+        for ( int i = 0; i < state_machine->states_size; ++i )
+        {
+            const ParserState* state = &state_machine->states[i];
+            for ( int j = 0; j < state->length; ++j )
+            {
+                const ParserTransition* transition = &state->transitions[j];
+                int index = state->index * state_machine->symbols_size + transition->symbol->index;
+                CHECK( state_machine->action_table[index] == transition->index );
+                if ( transition->symbol->type == SYMBOL_NON_TERMINAL )
+                {
+                    CHECK( state_machine->goto_table[index] == transition->state->index );
+                }
+            }
+        }
+
+        ParserStateMachine searched_state_machine = *state_machine;
+        searched_state_machine.action_table = nullptr;
+        searched_state_machine.goto_table = nullptr;
+        Parser<const char*> searched_parser( &searched_state_machine );
+        Parser<const char*> parser( state_machine );
+
+        const char* inputs[] = { "1", "1 + 2 * 3", "(1 + 2) * 3 + (4)", "1 +", "(1 + 2", "1 2" };
+        for ( size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); ++i )
+        {
+            const char* input = inputs[i];
+            parser.parse( input, input + strlen(input) );
+            searched_parser.parse( input, input + strlen(input) );
+            CHECK( parser.accepted() == searched_parser.accepted() );
+            CHECK( parser.full() == searched_parser.full() );
+        }
+    }
+
+    TEST( CompressedTables )
+    {
+        const char* compressed_grammar =
+            "CompressedTables {\n"
+            "   %whitespace \"[ \\t\\r\\n]*\";\n"
+            "   %left '+';\n"
+            "   %left '*';\n"
+            "   unit: expr [result];\n"
+            "   expr: expr '+' expr [add] | expr '*' expr [multiply] | '(' expr ')' [compound] | integer [integer];\n"
+            "   integer: \"[0-9]+\";\n"
+            "}"
+        ;
+
+        GrammarCompiler compiler;
+        compiler.compile( compressed_grammar, compressed_grammar + strlen(compressed_grammar) );
+        const ParserStateMachine* state_machine = compiler.parser_state_machine();
+        CHECK( state_machine->default_table );
+        CHECK( state_machine->base_table );
+        CHECK( state_machine->next_table );
+        CHECK( state_machine->check_table );
+        CHECK( state_machine->compressed_table_size < state_machine->states_size * state_machine->symbols_size );
+
+        for ( int i = 0; i < state_machine->states_size; ++i )
+        {
+            const ParserState* state = &state_machine->states[i];
+            for ( int j = 0; j < state->length; ++j )
+            {
+                const ParserTransition* transition = &state->transitions[j];
+                int index = state_machine->base_table[state->index] + transition->symbol->index;
+                CHECK( index < state_machine->compressed_table_size );
+                if ( state_machine->check_table[index] == state->index )
+                {
+                    CHECK( state_machine->next_table[index] == transition->index );
+                }
+                else
+                {
+                    int default_index = state_machine->default_table[state->index];
+                    CHECK( default_index != ParserTransition::INVALID_INDEX );
+                    CHECK( transition->type == TRANSITION_REDUCE );
+                    CHECK( transition->reduced_symbol == state_machine->transitions[default_index].reduced_symbol );
+                    CHECK( transition->reduced_length == state_machine->transitions[default_index].reduced_length );
+                }
+            }
+        }
+
+        ParserStateMachine compressed_state_machine = *state_machine;
+        compressed_state_machine.action_table = nullptr;
+        compressed_state_machine.goto_table = nullptr;
+        Parser<const char*, int> parser( &compressed_state_machine );
+        parser.parser_action_handlers()
+            ( "result", [] ( const int* data, const ParserNode<>* /*nodes*/, size_t /*length*/ ) { return data[0]; } )
+            ( "add", [] ( const int* data, const ParserNode<>* /*nodes*/, size_t /*length*/ ) { return data[0] + data[2]; } )
+            ( "multiply", [] ( const int* data, const ParserNode<>* /*nodes*/, size_t /*length*/ ) { return data[0] * data[2]; } )
+            ( "compound", [] ( const int* data, const ParserNode<>* /*nodes*/, size_t /*length*/ ) { return data[1]; } )
+            ( "integer", [] ( const int* /*data*/, const ParserNode<>* nodes, size_t /*length*/ ) { return ::atoi( nodes[0].lexeme().c_str() ); } )
+        ;
+
+        const char* input = "(1 + 2) * 3 + 4 * 5";
+        parser.parse( input, input + strlen(input) );
+        CHECK( parser.accepted() );
+        CHECK( parser.full() );
+        CHECK_EQUAL( 29, parser.user_data() );
+
+        const char* invalid_inputs[] = { "1 +", "(1 + 2", "1 2", ")" };
+        for ( size_t i = 0; i < sizeof(invalid_inputs) / sizeof(invalid_inputs[0]); ++i )
+        {
+            input = invalid_inputs[i];
+            parser.parse( input, input + strlen(input) );
+            CHECK( !parser.accepted() );
+        }
+    }
+
+    TEST( DefaultReductions )
+    {
+        const char* default_reductions_grammar =
+            "DefaultReductions {\n"
+            "   %whitespace \"[ \\t\\r\\n]*\";\n"
+            "   values: values value | value;\n"
+            "   value: 'null' [null] | integer [integer];\n"
+            "   integer: \"[0-9]+\";\n"
+            "}"
+        ;
+
+        GrammarCompiler compiler;
+        compiler.compile( default_reductions_grammar, default_reductions_grammar + strlen(default_reductions_grammar) );
+        const ParserStateMachine* state_machine = compiler.parser_state_machine();
+        CHECK( state_machine );
+
+        int default_transitions = 0;
+        for ( int i = 0; i < state_machine->states_size; ++i )
+        {
+            const ParserState* state = &state_machine->states[i];
+            if ( state->default_transition )
+            {
+                ++default_transitions;
+                CHECK( state->default_transition->type == TRANSITION_REDUCE );
+                CHECK( state->default_transition->reduced_symbol != state_machine->start_symbol );
+                for ( int j = 0; j < state->length; ++j )
+                {
+                    CHECK( state->transitions[j].type == TRANSITION_REDUCE );
+                    CHECK( state->transitions[j].reduced_symbol == state->default_transition->reduced_symbol );
+                }
+            }
+        }
+        CHECK( default_transitions > 0 );
+
+        const ParserSymbol* null_symbol = nullptr;
+        const ParserSymbol* integer_symbol = nullptr;
+        for ( int i = 0; i < state_machine->symbols_size; ++i )
+        {
+            const ParserSymbol* symbol = &state_machine->symbols[i];
+            null_symbol = strcmp(symbol->lexeme, "null") == 0 ? symbol : null_symbol;
+            integer_symbol = strcmp(symbol->identifier, "integer") == 0 ? symbol : integer_symbol;
+        }
+        CHECK( null_symbol && integer_symbol );
+
+        int nulls = 0;
+        int integers = 0;
+        Parser<const char*, int> parser( state_machine );
+        parser.parser_action_handlers()
+            ( "null", [&nulls] ( const int* /*data*/, const ParserNode<>* /*nodes*/, size_t /*length*/ ) { return ++nulls; } )
+            ( "integer", [&integers] ( const int* /*data*/, const ParserNode<>* /*nodes*/, size_t /*length*/ ) { return ++integers; } )
+        ;
+
+        parser.reset();
+        CHECK( parser.parse(null_symbol, "null", 1, 1) );
+        CHECK_EQUAL( 1, nulls );
+        CHECK( parser.parse(integer_symbol, "1", 1, 6) );
+        CHECK_EQUAL( 1, integers );
+        CHECK( parser.parse(null_symbol, "null", 1, 8) );
+        CHECK_EQUAL( 2, nulls );
+        CHECK( !parser.parse(state_machine->end_symbol, "", 1, 12) );
+        CHECK( parser.accepted() );
+
+        const char* input = "null 1 2 null";
+        parser.parse( input, input + strlen(input) );
+        CHECK( parser.accepted() );
+        CHECK( parser.full() );
+        CHECK_EQUAL( 4, nulls );
+        CHECK_EQUAL( 3, integers );
+    }
+
+    TEST( ZeroCopyLexemes )
+    {
+        struct StringLexer
+        {
+            static void string_lexer( const char* begin, const char* end, std::string* lexeme, const void** /*symbol*/, const char** position, int* lines )
+            {
+                const char* i = begin;
+                while ( i != end && *i != '\'' )
+                {
+                    ++i;
+                }
+                lexeme->assign( begin, i );
+                *position = i != end ? i + 1 : i;
+                *lines = 0;
+            }
+        };
+
+        const char* zero_copy_grammar =
+            "ZeroCopyLexemes {\n"
+            "   %whitespace \"[ \\t\\r\\n]*\";\n"
+            "   unit: values;\n"
+            "   values: values value | value;\n"
+            "   value: identifier [identifier] | string [string];\n"
+            "   identifier: \"[A-Za-z_]+\";\n"
+            "   string: \"':string:\";\n"
+            "}"
+        ;
+
+        GrammarCompiler compiler;
+        compiler.compile( zero_copy_grammar, zero_copy_grammar + strlen(zero_copy_grammar) );
+        const char* input = "first 'second' third";
+        const char* input_end = input + strlen( input );
+
+        std::vector<std::string> lexemes;
+        int borrowed = 0;
+        Parser<const char*, int> parser( compiler.parser_state_machine() );
+        parser.set_zero_copy_lexemes_enabled( true );
+        CHECK( parser.is_zero_copy_lexemes_enabled() );
+        parser.lexer_action_handlers()
+            ( "string", &StringLexer::string_lexer )
+        ;
+        parser.parser_action_handlers()
+            ( "identifier", [&] ( const int* /*data*/, const ParserNode<>* nodes, size_t /*length*/ )
+                {
+                    borrowed += nodes[0].lexeme_begin() >= input && nodes[0].lexeme_end() <= input_end ? 1 : 0;
+                    CHECK_EQUAL( strlen(nodes[0].lexeme().c_str()), nodes[0].lexeme_length() );
+                    lexemes.push_back( std::string(nodes[0].lexeme_begin(), nodes[0].lexeme_end()) );
+                    return 0;
+                }
+            )
+            ( "string", [&] ( const int* /*data*/, const ParserNode<>* nodes, size_t /*length*/ )
+                {
+                    CHECK( nodes[0].lexeme_begin() < input || nodes[0].lexeme_begin() >= input_end );
+                    lexemes.push_back( nodes[0].lexeme() );
+                    return 0;
+                }
+            )
+        ;
+
+        parser.parse( input, input_end );
+        CHECK( parser.accepted() );
+        CHECK( parser.full() );
+        CHECK_EQUAL( 2, borrowed );
+        CHECK( lexemes.size() == 3 && lexemes[0] == "first" && lexemes[1] == "second" && lexemes[2] == "third" );
+    }
+
+    TEST( FoldedWhitespace )
+    {
+        const char* folded_whitespace_grammar =
+            "FoldedWhitespace {\n"
+            "   %whitespace \"[ \\t\\r\\n]*\";\n"
+            "   unit: identifiers;\n"
+            "   identifiers: identifiers identifier | identifier;\n"
+            "   identifier: \"[A-Za-z_]+\" [identifier];\n"
+            "}"
+        ;
+
+        for ( int fold = 0; fold < 2; ++fold )
+        {
+            GrammarCompiler compiler;
+            compiler.set_whitespace_folding_enabled( fold != 0 );
+            CHECK( compiler.is_whitespace_folding_enabled() == (fold != 0) );
+            compiler.compile( folded_whitespace_grammar, folded_whitespace_grammar + strlen(folded_whitespace_grammar) );
+            const ParserStateMachine* state_machine = compiler.parser_state_machine();
+            CHECK( state_machine );
+            CHECK( (state_machine->whitespace_lexer_state_machine == nullptr) == (fold != 0) );
+            CHECK( (state_machine->lexer_state_machine->skip_symbol != nullptr) == (fold != 0) );
+
+            std::vector<std::string> identifiers;
+            Parser<const char*, int> parser( state_machine );
+            parser.parser_action_handlers()
+                ( "identifier", [&identifiers] ( const int* /*data*/, const ParserNode<>* nodes, size_t /*length*/ )
+                    {
+                        identifiers.push_back( nodes[0].lexeme() );
+                        return 0;
+                    }
+                )
+            ;
+
+            const char* input = "  abc \t def\n\nghi  ";
+            parser.parse( input, input + strlen(input) );
+            CHECK( parser.accepted() );
+            CHECK( parser.full() );
+            CHECK( identifiers.size() == 3 && identifiers[0] == "abc" && identifiers[1] == "def" && identifiers[2] == "ghi" );
+        }
+    }
+
+    TEST( LazyPositions )
+    {
+        struct PositionErrorPolicy : public ErrorPolicy
+        {
+            std::vector<std::pair<int, int>> errors;
+
+            void lalr_error( int line, int column, int /*error*/, const char* /*format*/, va_list /*args*/ )
+            {
+                errors.push_back( std::make_pair(line, column) );
+            }
+        };
+
+        const char* lazy_positions_grammar = 
+            "LazyPositions { \n"
+            "   %whitespace \"[ \\t\\n\\r]*\";"
+            "   %none error; \n"
+            "   %none integer; \n"
+            "   statements: statements statement | statement | %precedence integer; \n"
+            "   statement:  \n"
+            "       integer ';' [result] |  \n"
+            "       error ';' [unexpected_error] \n"
+            "   ; \n"
+            "   integer: \"[0-9]+\"; \n"
+            "} \n"
+        ;
+
+        GrammarCompiler compiler;
+        compiler.compile( lazy_positions_grammar, lazy_positions_grammar + strlen(lazy_positions_grammar) );
+        CHECK( compiler.parser_state_machine() );
+
+        const char* input = "1;\r\n  22;\n\n\r   a;\n4;";
+        std::vector<std::pair<int, int>> positions [2];
+        std::vector<std::pair<int, int>> errors [2];
+        for ( int lazy = 0; lazy < 2; ++lazy )
+        {
+            PositionErrorPolicy error_policy;
+            Parser<const char*, int> parser( compiler.parser_state_machine(), &error_policy );
+            parser.set_lazy_positions_enabled( lazy != 0 );
+            CHECK( parser.is_lazy_positions_enabled() == (lazy != 0) );
+            parser.parser_action_handlers()
+                ( "result", [&positions, lazy] ( const int* /*data*/, const ParserNode<>* nodes, size_t /*length*/ )
+                    {
+                        positions[lazy].push_back( std::make_pair(nodes[0].line(), nodes[0].column()) );
+                        return 0;
+                    }
+                )
+            ;
+            parser.parse( input, input + strlen(input) );
+            CHECK( parser.accepted() );
+            CHECK( parser.full() );
+            CHECK( (parser.lexer().positions() != nullptr) == (lazy != 0) );
+            errors[lazy] = error_policy.errors;
+        }
+
+        CHECK( positions[1].size() == 3 );
+        CHECK( positions[1][0] == std::make_pair(1, 1) );
+        CHECK( positions[1][1] == std::make_pair(2, 3) );
+        CHECK( positions[1][2] == std::make_pair(6, 1) );
+        CHECK( positions[0] == positions[1] );
+        CHECK( !errors[1].empty() && errors[1][0] == std::make_pair(5, 4) );
+        CHECK( errors[0] == errors[1] );
+
+        Parser<std::string::const_iterator, int> string_parser( compiler.parser_state_machine() );
+        string_parser.set_lazy_positions_enabled( true );
+        const std::string string_input( "1; 2;" );
+        string_parser.parse( string_input.begin(), string_input.end() );
+        CHECK( string_parser.accepted() );
+        CHECK( string_parser.lexer().positions() == nullptr );
+    }
+
+    TEST( StreamedInput )
+    {
+        const char* streamed_input_grammar =
+            "StreamedInput {\n"
+            "   %whitespace \"([ \\t\\r\\n]|#[^\\n]*\\n)*\";\n"
+            "   unit: items;\n"
+            "   items: items item | item;\n"
+            "   item: identifier [item] | integer [item] | '==' [item] | '=' [item];\n"
+            "   identifier: \"[A-Za-z_][A-Za-z0-9_]*\";\n"
+            "   integer: \"[0-9]+\";\n"
+            "}"
+        ;
+
+        GrammarCompiler compiler;
+        compiler.compile( streamed_input_grammar, streamed_input_grammar + strlen(streamed_input_grammar) );
+        CHECK( compiler.parser_state_machine() );
+
+        std::vector<std::string> items;
+        Parser<const char*, int> parser( compiler.parser_state_machine() );
+        parser.parser_action_handlers()
+            ( "item", [&items] ( const int* /*data*/, const ParserNode<>* nodes, size_t /*length*/ )
+                {
+                    char position [32];
+                    snprintf( position, sizeof(position), "@%d:%d", nodes[0].line(), nodes[0].column() );
+                    items.push_back( nodes[0].lexeme() + position );
+                    return 0;
+                }
+            )
+        ;
+
+        const std::string input = "first = 12345 # a comment\r\nsecond==third\r\n\r\n  = fourth_identifier 6";
+        parser.parse( input.c_str(), input.c_str() + input.size() );
+        CHECK( parser.accepted() );
+        CHECK( parser.full() );
+        const std::vector<std::string> expected_items = items;
+        CHECK_EQUAL( 9u, expected_items.size() );
+
+        for ( size_t size = 1; size <= input.size(); ++size )
+        {
+            items.clear();
+            std::vector<char> chunk;
+            for ( size_t i = 0; i < input.size(); i += size )
+            {
+                chunk.assign( input.begin() + i, input.begin() + std::min(i + size, input.size()) );
+                parser.feed( &chunk[0], &chunk[0] + chunk.size() );
+                std::fill( chunk.begin(), chunk.end(), '!' );
+            }
+            parser.finish();
+            CHECK( parser.accepted() );
+            CHECK( parser.full() );
+            CHECK( items == expected_items );
+        }
+
+        items.clear();
+        parser.finish();
+        CHECK( !parser.accepted() );
+        CHECK( items.empty() );
+    }
+
+    TEST( ParseFile )
+    {
+        struct CountErrorPolicy : public ErrorPolicy
+        {
+            int errors;
+            int error;
+
+            CountErrorPolicy()
+            : errors( 0 ),
+              error( PARSER_ERROR_NONE )
+            {
+            }
+
+            void lalr_error( int /*line*/, int /*column*/, int error, const char* /*format*/, va_list /*args*/ )
+            {
+                ++errors;
+                this->error = error;
+            }
+        };
+
+        const char* parse_file_grammar =
+            "ParseFile {\n"
+            "   %whitespace \"[ \\t\\r\\n]*\";\n"
+            "   unit: identifiers;\n"
+            "   identifiers: identifiers identifier | identifier;\n"
+            "   identifier: \"[A-Za-z_]+\" [identifier];\n"
+            "}"
+        ;
+
+        GrammarCompiler compiler;
+        compiler.compile( parse_file_grammar, parse_file_grammar + strlen(parse_file_grammar) );
+        CHECK( compiler.parser_state_machine() );
+
+        const char* path = "lalr_test_parse_file.txt";
+        FILE* file = fopen( path, "wb" );
+        CHECK( file );
+        fputs( "first second\nthird", file );
+        fclose( file );
+
+        std::vector<std::string> identifiers;
+        CountErrorPolicy error_policy;
+        Parser<const char*, int> parser( compiler.parser_state_machine(), &error_policy );
+        parser.set_zero_copy_lexemes_enabled( true );
+        parser.parser_action_handlers()
+            ( "identifier", [&identifiers] ( const int* /*data*/, const ParserNode<>* nodes, size_t /*length*/ )
+                {
+                    identifiers.push_back( std::string(nodes[0].lexeme_begin(), nodes[0].lexeme_end()) );
+                    return 0;
+                }
+            )
+        ;
+        parser.parse_file( path );
+        remove( path );
+        CHECK( parser.accepted() );
+        CHECK( parser.full() );
+        CHECK( identifiers.size() == 3 && identifiers[0] == "first" && identifiers[1] == "second" && identifiers[2] == "third" );
+        CHECK_EQUAL( 0, error_policy.errors );
+
+        parser.parse_file( path );
+        CHECK( !parser.accepted() );
+        CHECK_EQUAL( 1, error_policy.errors );
+        CHECK_EQUAL( int(PARSER_ERROR_OPENING_FILE_FAILED), error_policy.error );
+    }
+
+    TEST( BatchParsing )
+    {
+        const char* batch_parsing_grammar =
+            "BatchParsing {\n"
+            "   %whitespace \"[ \\t\\r\\n]*\";\n"
+            "   %left '+';\n"
+            "   expr: expr '+' expr [add] | integer [integer];\n"
+            "   integer: \"[0-9]+\";\n"
+            "}"
+        ;
+
+        GrammarCompiler compiler;
+        compiler.compile( batch_parsing_grammar, batch_parsing_grammar + strlen(batch_parsing_grammar) );
+        CHECK( compiler.parser_state_machine() );
+
+        int bound = 0;
+        BatchParser<const char*, int> batch_parser( compiler.parser_state_machine(), [&bound] (Parser<const char*, int>* parser)
+            {
+                ++bound;
+                parser->parser_action_handlers()
+                    ( "add", [] ( const int* data, const ParserNode<>* /*nodes*/, size_t /*length*/ ) { return data[0] + data[2]; } )
+                    ( "integer", [] ( const int* /*data*/, const ParserNode<>* nodes, size_t /*length*/ ) { return ::atoi(nodes[0].lexeme().c_str()); } )
+                ;
+            },
+            4
+        );
+        CHECK_EQUAL( 4, batch_parser.threads() );
+        CHECK_EQUAL( 4, bound );
+
+        std::vector<std::string> inputs;
+        for ( int i = 0; i < 200; ++i )
+        {
+            std::string input = std::to_string( i );
+            for ( int j = 0; j < i % 17; ++j )
+            {
+                input += " + 1";
+            }
+            inputs.push_back( i % 10 == 9 ? input + " +" : input );
+        }
+
+        std::vector<BatchParser<const char*, int>::Document> documents;
+        for ( auto i = inputs.begin(); i != inputs.end(); ++i )
+        {
+            documents.push_back( std::make_pair(i->c_str(), i->c_str() + i->size()) );
+        }
+
+        for ( int batch = 0; batch < 2; ++batch )
+        {
+            batch_parser.parse( documents );
+            CHECK_EQUAL( documents.size(), batch_parser.size() );
+            for ( int i = 0; i < int(documents.size()); ++i )
+            {
+                bool valid = i % 10 != 9;
+                CHECK_EQUAL( valid, batch_parser.accepted(i) );
+                CHECK_EQUAL( valid ? i + i % 17 : 0, batch_parser.user_data(i) );
+            }
+        }
+    }
+
+    TEST( ParserTreeNodes )
+    {
+        struct Leaves
+        {
+            static void collect( ParserTreeCursor<char> cursor, std::string* leaves )
+            {
+                if ( cursor.symbol()->type != SYMBOL_NON_TERMINAL )
+                {
+                    *leaves += cursor.lexeme();
+                }
+                for ( ParserTreeCursor<char> child = cursor.first_child(); child.valid(); child = child.next_sibling() )
+                {
+                    collect( child, leaves );
+                }
+            }
+        };
+
+        const char* tree_grammar =
+            "ParserTreeNodes {\n"
+            "   %whitespace \"[ \\t\\r\\n]*\";\n"
+            "   list: '(' items ')' [list];\n"
+            "   items: items ',' item | item | ;\n"
+            "   item: name | list;\n"
+            "   name: \"[a-z]+\";\n"
+            "}"
+        ;
+
+        GrammarCompiler compiler;
+        compiler.compile( tree_grammar, tree_grammar + strlen(tree_grammar) );
+        CHECK( compiler.parser_state_machine() );
+
+        const char* input = "(a, (bb, c), (), ddd)";
+        ParserTree<char> tree( compiler.parser_state_machine() );
+        Parser<const char*, int> parser( compiler.parser_state_machine() );
+        tree.bind( &parser );
+        for ( int zero_copy = 0; zero_copy < 2; ++zero_copy )
+        {
+            tree.reset();
+            CHECK_EQUAL( 0u, tree.size() );
+            CHECK( !tree.root().valid() );
+            parser.set_zero_copy_lexemes_enabled( zero_copy != 0 );
+            parser.parse( input, input + strlen(input) );
+            CHECK( parser.accepted() );
+            CHECK( parser.full() );
+
+            ParserTreeCursor<char> root = tree.root();
+            CHECK( root.valid() );
+            CHECK_EQUAL( parser.user_data(), root.index() );
+            CHECK_EQUAL( "list", root.symbol()->identifier );
+            CHECK_EQUAL( 3u, root.children() );
+            CHECK_EQUAL( "(", root.first_child().lexeme() );
+            CHECK_EQUAL( "items", root.first_child().next_sibling().symbol()->identifier );
+            CHECK_EQUAL( ")", root.first_child().next_sibling().next_sibling().lexeme() );
+            CHECK( !root.first_child().next_sibling().next_sibling().next_sibling().valid() );
+            CHECK( !root.first_child().first_child().valid() );
+
+            std::string leaves;
+            Leaves::collect( root, &leaves );
+            CHECK_EQUAL( "(a,(bb,c),(),ddd)", leaves );
+            if ( zero_copy )
+            {
+                CHECK( root.begin() == input );
+                CHECK( root.end() == input + strlen(input) );
+                CHECK_EQUAL( input, root.lexeme() );
+            }
+        }
+    }
+
+    TEST( EventParsing )
+    {
+        struct EventHandler
+        {
+            std::string events;
+
+            void on_shift( const ParserSymbol* symbol, const char* lexeme_begin, const char* lexeme_end )
+            {
+                events += std::string( lexeme_begin, lexeme_end ) + " ";
+                CHECK( symbol->type == SYMBOL_TERMINAL );
+            }
+
+            void on_reduce( const ParserSymbol* symbol, const ParserAction* action, size_t length )
+            {
+                events += std::string( symbol->identifier ) + "/" + std::to_string( length ) + (action ? std::string("[") + action->identifier + "]" : std::string()) + " ";
+            }
+        };
+
+        struct PositionErrorPolicy : public ErrorPolicy
+        {
+            std::vector<std::pair<int, int>> errors;
+
+            void lalr_error( int line, int column, int /*error*/, const char* /*format*/, va_list /*args*/ )
+            {
+                errors.push_back( std::make_pair(line, column) );
+            }
+        };
+
+        const char* event_grammar =
+            "EventParsing {\n"
+            "   %whitespace \"[ \\t\\r\\n]*\";\n"
+            "   list: '(' items ')' [list];\n"
+            "   items: items ',' item | item | ;\n"
+            "   item: name | list;\n"
+            "   name: \"[a-z]+\";\n"
+            "}"
+        ;
+
+        GrammarCompiler compiler;
+        compiler.compile( event_grammar, event_grammar + strlen(event_grammar) );
+        CHECK( compiler.parser_state_machine() );
+
+        EventHandler handler;
+        PositionErrorPolicy error_policy;
+        EventParser<const char*, EventHandler> parser( compiler.parser_state_machine(), &handler, &error_policy );
+        const char* input = "(a, (bb), ())";
+        parser.parse( input, input + strlen(input) );
+        CHECK( parser.accepted() );
+        CHECK( parser.full() );
+        CHECK_EQUAL( "( a item/1 items/1 , ( bb item/1 items/1 ) list/3[list] item/1 items/3 , ( items/0 ) list/3[list] item/1 items/3 ) list/3[list] ", handler.events );
+        CHECK( error_policy.errors.empty() );
+
+        handler.events.clear();
+        const char* invalid_input = "(a,\n  b c)";
+        parser.parse( invalid_input, invalid_input + strlen(invalid_input) );
+        CHECK( !parser.accepted() );
+        CHECK_EQUAL( 1u, error_policy.errors.size() );
+        if ( !error_policy.errors.empty() )
+        {
+            CHECK_EQUAL( 2, error_policy.errors[0].first );
+            CHECK_EQUAL( 5, error_policy.errors[0].second );
+        }
+    }
+
+    TEST( RecognizeOnly )
+    {
+        const char* recognizer_grammar = 
+            "RecognizeOnly { \n"
+            "   %whitespace \"[ \\t\\n\\r]*\";"
+            "   %none error; \n"
+            "   %none integer; \n"
+            "   statements: statements statement | statement | %precedence integer; \n"
+            "   statement:  \n"
+            "       integer ';' [result] |  \n"
+            "       error ';' [unexpected_error] \n"
+            "   ; \n"
+            "   integer: \"[0-9]+\"; \n"
+            "} \n"
+        ;
+
+        GrammarCompiler compiler;
+        compiler.compile( recognizer_grammar, recognizer_grammar + strlen(recognizer_grammar) );
+        CHECK( compiler.parser_state_machine() );
+
+        Recognizer<const char*> recognizer( compiler.parser_state_machine() );
+        const char* valid_input = "1;\r\n  22;\n4;";
+        CHECK( recognizer.recognize(valid_input, valid_input + strlen(valid_input)) );
+        CHECK( recognizer.accepted() );
+        CHECK( recognizer.full() );
+        CHECK_EQUAL( PARSER_ERROR_NONE, recognizer.error() );
+
+        const char* lexical_error_input = "1;\r\n  22;\n\n\r   a;\n4;";
+        CHECK( !recognizer.recognize(lexical_error_input, lexical_error_input + strlen(lexical_error_input)) );
+        CHECK_EQUAL( LEXER_ERROR_LEXICAL_ERROR, recognizer.error() );
+        CHECK_EQUAL( 5, recognizer.line() );
+        CHECK_EQUAL( 4, recognizer.column() );
+
+        const char* syntax_error_input = "1;\n2 2;";
+        CHECK( !recognizer.recognize(syntax_error_input, syntax_error_input + strlen(syntax_error_input)) );
+        CHECK( !recognizer.accepted() );
+        CHECK_EQUAL( PARSER_ERROR_SYNTAX, recognizer.error() );
+        CHECK_EQUAL( 2, recognizer.line() );
+        CHECK_EQUAL( 3, recognizer.column() );
+
+        Parser<const char*, int> parser( compiler.parser_state_machine() );
+        parser.parse( syntax_error_input, syntax_error_input + strlen(syntax_error_input) );
+        CHECK( parser.accepted() );
+
+        Recognizer<std::string::const_iterator> string_recognizer( compiler.parser_state_machine() );
+        const std::string string_input( "1; 2;" );
+        CHECK( string_recognizer.recognize(string_input.begin(), string_input.end()) );
+    }
+
+    TEST( CompactStack )
+    {
+        const char* list_grammar =
+            "CompactStack {\n"
+            "   %whitespace \"[ \\t\\r\\n]*\";\n"
+            "   list: '[' contents ']' [list];\n"
+            "   contents: contents ',' content [add] | content [create];\n"
+            "   content: integer [content] | list [content];\n"
+            "   integer: \"[0-9]+\";\n"
+            "}"
+        ;
+
+        GrammarCompiler compiler;
+        compiler.compile( list_grammar, list_grammar + strlen(list_grammar) );
+        CHECK( compiler.parser_state_machine() );
+
+        std::string input( "[" );
+        for ( int i = 0; i < 10000; ++i )
+        {
+            input += i > 0 ? ", " : "";
+            input += i % 1000 == 999 ? "[1, 2]" : std::to_string( i );
+        }
+        input += "]";
+
+        Parser<const char*, int> parser( compiler.parser_state_machine() );
+        parser.parse( input.c_str(), input.c_str() + input.size() );
+        CHECK( parser.accepted() );
+        CHECK( parser.full() );
+        CHECK_EQUAL( 0, parser.user_data() );
+
+        parser.parser_action_handlers()
+            ( "list", [] ( const int* data, const ParserNode<>* /*nodes*/, size_t /*length*/ ) { return data[1]; } )
+            ( "add", [] ( const int* data, const ParserNode<>* /*nodes*/, size_t /*length*/ ) { return data[0] + data[2]; } )
+            ( "create", [] ( const int* data, const ParserNode<>* /*nodes*/, size_t /*length*/ ) { return data[0]; } )
+            ( "content", [] ( const int* data, const ParserNode<>* nodes, size_t /*length*/ ) { return nodes[0].symbol()->type == SYMBOL_TERMINAL ? 1 : data[0]; } )
+        ;
+        parser.parse( input.c_str(), input.c_str() + input.size() );
+        CHECK( parser.accepted() );
+        CHECK( parser.full() );
+        CHECK_EQUAL( 10010, parser.user_data() );
+
+        const char* invalid_input = "[1, 2,, 3]";
+        parser.parse( invalid_input, invalid_input + strlen(invalid_input) );
+        CHECK( !parser.accepted() );
+
+        struct Symbols
+        {
+            static const ParserSymbol* find( const ParserStateMachine* state_machine, const char* lexeme )
+            {
+                for ( int i = 0; i < state_machine->symbols_size; ++i )
+                {
+                    if ( state_machine->symbols[i].lexeme && strcmp(state_machine->symbols[i].lexeme, lexeme) == 0 )
+                    {
+                        return &state_machine->symbols[i];
+                    }
+                }
+                return nullptr;
+            }
+        };
+
+        const ParserStateMachine* state_machine = compiler.parser_state_machine();
+        Parser<const char*, int> late_parser( state_machine );
+        late_parser.reset();
+        CHECK( late_parser.parse(Symbols::find(state_machine, "["), "[", 1, 1) );
+        int lists = 0;
+        late_parser.set_action_handler( "list", [&lists] ( const int* /*data*/, const ParserNode<>* /*nodes*/, size_t length )
+            {
+                ++lists;
+                CHECK_EQUAL( 3u, length );
+                return 0;
+            }
+        );
+        CHECK( late_parser.parse(Symbols::find(state_machine, "[0-9]+"), "1", 1, 2) );
+        CHECK( late_parser.parse(Symbols::find(state_machine, "]"), "]", 1, 3) );
+        CHECK( !late_parser.parse(state_machine->end_symbol, "", 1, 4) );
+        CHECK( late_parser.accepted() );
+        CHECK_EQUAL( 1, lists );
+    }
+
+    TEST( MoveOnlyUserData )
+    {
+        typedef std::unique_ptr<std::vector<int>> Integers;
+
+        const char* list_grammar =
+            "MoveOnlyUserData {\n"
+            "   %whitespace \"[ \\t\\r\\n]*\";\n"
+            "   list: '[' integers ']' [list];\n"
+            "   integers: integers ',' integer [add] | integer [create];\n"
+            "   integer: \"[0-9]+\";\n"
+            "}"
+        ;
+
+        GrammarCompiler compiler;
+        compiler.compile( list_grammar, list_grammar + strlen(list_grammar) );
+        CHECK( compiler.parser_state_machine() );
+
+        const std::vector<int>* created = nullptr;
+        Parser<const char*, Integers> parser( compiler.parser_state_machine() );
+        parser.parser_action_handlers()
+            ( "list", [] ( Integers* data, const ParserNode<>* /*nodes*/, size_t /*length*/ ) 
+                { 
+                    return std::move( data[1] ); 
+                } 
+            )
+            ( "add", [] ( Integers* data, const ParserNode<>* nodes, size_t /*length*/ ) 
+                { 
+                    data[0]->push_back( atoi(nodes[2].lexeme().c_str()) );
+                    return std::move( data[0] );
+                } 
+            )
+            ( "create", [&created] ( Integers* /*data*/, const ParserNode<>* nodes, size_t /*length*/ ) 
+                { 
+                    Integers integers( new std::vector<int>(1, atoi(nodes[0].lexeme().c_str())) );
+                    created = integers.get();
+                    return integers;
+                } 
+            )
+        ;
+
+        const char* input = "[1, 2, 3, 5, 8]";
+        parser.parse( input, input + strlen(input) );
+        CHECK( parser.accepted() );
+        CHECK( parser.full() );
+        CHECK( parser.user_data() && parser.user_data().get() == created );
+        if ( parser.user_data() )
+        {
+            const int expected [] = { 1, 2, 3, 5, 8 };
+            CHECK( *parser.user_data() == std::vector<int>(expected, expected + 5) );
+        }
+    }
+
+    TEST( StaticParsing )
+    {
+        // The grammar in static_parsing.g that lalrc generates the 
+        // static_parsing_actions.hpp header from during the build.
+        const char* sum_grammar =
+            "static_parsing {\n"
+            "   %left '+';\n"
+            "   %whitespace \"[ \\t\\r\\n]*\";\n"
+            "   expr: expr '+' expr [add] | integer [integer] | '(' expr ')';\n"
+            "   integer: \"[0-9]+\";\n"
+            "}"
+        ;
+
+        GrammarCompiler compiler;
+        compiler.compile( sum_grammar, sum_grammar + strlen(sum_grammar) );
+        const ParserStateMachine* state_machine = compiler.parser_state_machine();
+        CHECK( state_machine );
+        CHECK_EQUAL( 2, state_machine->actions_size );
+        CHECK_EQUAL( "add", state_machine->actions[int(static_parsing_action::add)].identifier );
+        CHECK_EQUAL( "integer", state_machine->actions[int(static_parsing_action::integer)].identifier );
+
+        StaticParsingHandler handler;
+        handler.reductions = 0;
+        StaticParser<const char*, StaticParsingHandler, static_parsing_actions, int> parser( state_machine, &handler );
+        parser.set_default_action_handler( [] ( int* data, const ParserNode<>* /*nodes*/, size_t length ) 
+            {
+                return length == 3 ? data[1] : 0;
+            }
+        );
+        CHECK( parser.handler() == &handler );
+
+        const char* input = "1 + (2 + 3) + 5";
+        parser.parse( input, input + strlen(input) );
+        CHECK( parser.accepted() );
+        CHECK( parser.full() );
+        CHECK_EQUAL( 11, parser.user_data() );
+        CHECK_EQUAL( 7, handler.reductions );
+    }
+
+    TEST( LookaheadsOverManySymbols )
+    {
+        // More than 64 terminals and non-terminals so that first, follow, and
+        // lookahead sets span more than one word.
+        std::string grammar = "LookaheadsOverManySymbols {\n   %whitespace \"[ \\t\\r\\n]*\";\n   statements: statements statement | ;\n   statement: ";
+        for ( int i = 0; i < 80; ++i )
+        {
+            std::string index = std::to_string( i );
+            grammar += (i > 0 ? " | 'k" : "'k") + index + "' optional" + index + " ';'";
+        }
+        grammar += ";\n";
+        for ( int i = 0; i < 80; ++i )
+        {
+            std::string index = std::to_string( i );
+            grammar += "   optional" + index + ": 'v" + index + "' | ;\n";
+        }
+        grammar += "}";
+
+        GrammarCompiler compiler;
+        int errors = compiler.compile( grammar.c_str(), grammar.c_str() + grammar.size() );
+        CHECK_EQUAL( 0, errors );
+        CHECK( compiler.parser_state_machine() );
+
+        Parser<const char*, int> parser( compiler.parser_state_machine() );
+        const char* input = "k0 v0; k63; k64 v64; k79 v79; k79;";
+        parser.parse( input, input + strlen(input) );
+        CHECK( parser.accepted() );
+        CHECK( parser.full() );
+
+        const char* mismatched = "k64 v63;";
+        parser.parse( mismatched, mismatched + strlen(mismatched) );
+        CHECK( !parser.accepted() );
+    }
 }
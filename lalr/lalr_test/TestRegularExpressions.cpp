@@ -5,8 +5,11 @@
 
 #include <UnitTest++/UnitTest++.h>
 #include <lalr/RegexCompiler.hpp>
+#include <lalr/RegexToken.hpp>
+#include <lalr/ErrorPolicy.hpp>
 #include <lalr/Lexer.ipp>
 #include <lalr/PositionIterator.hpp>
+#include <stdio.h>
 #include <string.h>
 
 using std::string;
@@ -14,6 +17,18 @@ using namespace lalr;
 
 SUITE( RegularExpressions )
 {
+    struct RecordPrintfErrorPolicy : public ErrorPolicy
+    {
+        std::string printed;
+
+        void lalr_vprintf( const char* format, va_list args )
+        {
+            char buffer [256];
+            vsnprintf( buffer, sizeof(buffer), format, args );
+            printed += buffer;
+        }
+    };
+
     TEST( Concatenation )
     {
         void* ab;
@@ -1288,4 +1303,167 @@ SUITE( RegularExpressions )
         CHECK( lexer.symbol() == &whitespace );
         CHECK( lexer.position().line() == 5 );        
     }
+    
+    
+    TEST( LexemeRange )
+    {
+        void* ab_star;
+        RegexCompiler compiler;
+        compiler.compile( "ab*", &ab_star );
+        Lexer<const char*> lexer( compiler.state_machine(), NULL );
+
+        const char* regex = "abbbab";
+        lexer.reset( regex, regex + strlen(regex) );
+        lexer.advance();
+        const char* begin = nullptr;
+        const char* end = nullptr;
+        CHECK( lexer.symbol() == &ab_star );
+        CHECK( lexer.lexeme_range(&begin, &end) );
+        CHECK( begin == regex && end == regex + 4 );
+        CHECK( lexer.lexeme() == "abbb" );
+
+        lexer.advance();
+        CHECK( lexer.symbol() == &ab_star );
+        CHECK( lexer.lexeme_range(&begin, &end) );
+        CHECK( begin == regex + 4 && end == regex + 6 );
+        CHECK( lexer.lexeme() == "ab" );
+        CHECK( lexer.lexeme() == "ab" );
+    }
+    
+    
+    TEST( CharacterClasses )
+    {
+        void* identifier;
+        RegexCompiler compiler;
+        compiler.compile( "[A-Za-z_][A-Za-z0-9_]*|[0-9]+|\\+\\+|\\+", &identifier );
+        const LexerStateMachine* state_machine = compiler.state_machine();
+        CHECK( state_machine->character_classes );
+        CHECK( state_machine->transition_table );
+        CHECK( state_machine->classes_size > 1 && state_machine->classes_size < 256 );
+
+        for ( int i = 0; i < state_machine->states_size; ++i )
+        {
+            const LexerState* state = &state_machine->states[i];
+            for ( int character = 0; character < 256; ++character )
+            {
+                int expected_index = LexerTransition::INVALID_INDEX;
+                for ( int j = 0; j < state->length; ++j )
+                {
+                    const LexerTransition* transition = &state->transitions[j];
+                    if ( character >= transition->begin && character < transition->end )
+                    {
+                        expected_index = int(transition - state_machine->transitions);
+                    }
+                }
+                int index = state_machine->transition_table[state->index * state_machine->classes_size + state_machine->character_classes[character]];
+                CHECK_EQUAL( expected_index, index );
+            }
+        }
+
+        Lexer<const char*> lexer( state_machine );
+        const char* regex = "identifier_1";
+        lexer.reset( regex, regex + strlen(regex) );
+        lexer.advance();
+        CHECK( lexer.symbol() == &identifier );
+        CHECK( lexer.lexeme() == "identifier_1" );
+    }
+    
+    
+    TEST( MinimizedStates )
+    {
+        void* ab_or_cb;
+        RegexCompiler compiler;
+        compiler.compile( "ab|cb", &ab_or_cb );
+        CHECK_EQUAL( 3, compiler.state_machine()->states_size );
+        Lexer<const char*> lexer( compiler.state_machine(), NULL );
+
+        const char* regex = "ab";
+        lexer.reset( regex, regex + strlen(regex) );
+        lexer.advance();
+        CHECK( lexer.symbol() == &ab_or_cb );
+        CHECK( lexer.lexeme() == "ab" );
+
+        regex = "cb";
+        lexer.reset( regex, regex + strlen(regex) );
+        lexer.advance();
+        CHECK( lexer.symbol() == &ab_or_cb );
+        CHECK( lexer.lexeme() == "cb" );
+
+        regex = "ac";
+        lexer.reset( regex, regex + strlen(regex) );
+        lexer.advance();
+        CHECK( lexer.symbol() == NULL );
+    }
+
+
+    TEST( MinimizedStatesReported )
+    {
+        void* for_keyword = (void*) 0x1;
+        void* if_keyword = (void*) 0x2;
+        void* identifier = (void*) 0x3;
+        std::vector<RegexToken> tokens;
+        tokens.push_back( RegexToken(TOKEN_LITERAL, 0, 1, for_keyword, "for") );
+        tokens.push_back( RegexToken(TOKEN_LITERAL, 0, 1, if_keyword, "if") );
+        tokens.push_back( RegexToken(TOKEN_REGULAR_EXPRESSION, 0, 1, identifier, "[a-z][a-z0-9]*|_[a-z0-9]+") );
+        RecordPrintfErrorPolicy error_policy;
+        RegexCompiler compiler;
+        compiler.compile( tokens, &error_policy );
+
+        int states = 0;
+        int minimized_states = 0;
+        CHECK_EQUAL( 2, sscanf(error_policy.printed.c_str(), "Minimized %d lexer states to %d\n", &states, &minimized_states) );
+        CHECK( minimized_states < states );
+        CHECK_EQUAL( minimized_states, compiler.state_machine()->states_size );
+
+        Lexer<const char*> lexer( compiler.state_machine() );
+        const char* input = "for";
+        lexer.reset( input, input + strlen(input) );
+        lexer.advance();
+        CHECK( lexer.symbol() == for_keyword );
+        input = "_for1";
+        lexer.reset( input, input + strlen(input) );
+        lexer.advance();
+        CHECK( lexer.symbol() == identifier );
+        CHECK( lexer.lexeme() == "_for1" );
+    }
+    
+    
+    TEST( LoopingStates )
+    {
+        void* identifier;
+        void* whitespace;
+        RegexCompiler compiler;
+        RegexCompiler whitespace_compiler;
+        compiler.compile( "[A-Za-z_][A-Za-z0-9_]*", &identifier );
+        whitespace_compiler.compile( "[ \\t\\r\\n]*", &whitespace );
+        const LexerStateMachine* state_machine = compiler.state_machine();
+        CHECK_EQUAL( 1, state_machine->loops_size );
+        CHECK_EQUAL( 4, state_machine->loops[0].ranges_size );
+        CHECK( state_machine->loops[0].ranges[0] == '0' && state_machine->loops[0].ranges[1] == '9' );
+        CHECK( state_machine->loops[0].ranges[6] == 'a' && state_machine->loops[0].ranges[7] == 'z' );
+        CHECK_EQUAL( 1, whitespace_compiler.state_machine()->loops_size );
+
+        const char* input = "abcdefghijklmnopqrstuvwxyz_0123456789 \t \r\n\n    \r   next_identifier_that_is_long\xe9";
+        const string string_input( input );
+        Lexer<const char*> lexer( state_machine, whitespace_compiler.state_machine() );
+        Lexer<string::const_iterator> string_lexer( state_machine, whitespace_compiler.state_machine() );
+        lexer.reset( input, input + strlen(input) );
+        string_lexer.reset( string_input.begin(), string_input.end() );
+
+        lexer.advance();
+        string_lexer.advance();
+        CHECK( lexer.symbol() == &identifier );
+        CHECK( lexer.lexeme() == "abcdefghijklmnopqrstuvwxyz_0123456789" );
+        CHECK( string_lexer.lexeme() == lexer.lexeme() );
+
+        lexer.advance();
+        string_lexer.advance();
+        CHECK( lexer.symbol() == &identifier );
+        CHECK( lexer.lexeme() == "next_identifier_that_is_long" );
+        CHECK( string_lexer.lexeme() == lexer.lexeme() );
+        CHECK_EQUAL( 4, lexer.line() );
+        CHECK_EQUAL( 4, lexer.column() );
+        CHECK_EQUAL( lexer.line(), string_lexer.line() );
+        CHECK_EQUAL( lexer.column(), string_lexer.column() );
+    }
 }
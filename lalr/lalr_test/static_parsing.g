@@ -0,0 +1,6 @@
+static_parsing {
+    %left '+';
+    %whitespace "[ \t\r\n]*";
+    expr: expr '+' expr [add] | integer [integer] | '(' expr ')';
+    integer: "[0-9]+";
+}
@@ -15,6 +15,8 @@
 #include <lalr/LexerStateMachine.hpp>
 #include <lalr/LexerState.hpp>
 #include <lalr/LexerTransition.hpp>
+#include <lalr/LexerLoop.hpp>
+#include <lalr/MappedFile.hpp>
 #include <lalr/LexerAction.hpp>
 #include <lalr/ErrorPolicy.hpp>
 #include <string>
@@ -23,8 +25,8 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <ctype.h>
 #include <errno.h>
-#include <sys/stat.h>
 
 using std::string;
 using std::vector;
@@ -34,20 +36,55 @@ using namespace lalr;
 static FILE* file_ = nullptr;
 static int errors_ = 0;
 
+/**
+// Reports errors as usual but only prints debug output from the compiler
+// when statistics are requested so that it doesn't end up in generated 
+// code written to stdout.
+*/
+class LalrcErrorPolicy : public ErrorPolicy
+{
+    bool print_;
+
+public:
+    LalrcErrorPolicy( bool print )
+    : print_( print )
+    {
+    }
+
+    void lalr_vprintf( const char* format, va_list args )
+    {
+        if ( print_ )
+        {
+            ErrorPolicy::lalr_vprintf( format, args );
+        }
+    }
+};
+
 static void error( const char* format, ... );
 static void open( const char* filename );
 static void close();
 static void write( const char* format, ... );
 static void print_cxx_parser_state_machine( const ParserStateMachine* state_machine );
-static void generate_cxx_parser_state_machine( const ParserStateMachine* state_machine );
+static void statistics_cxx_parser_state_machine( const ParserStateMachine* state_machine );
+static void generate_cxx_parser_state_machine( const ParserStateMachine* state_machine, bool compress );
+static bool check_cxx_parser_actions( const ParserStateMachine* state_machine );
+static void generate_cxx_parser_actions( const ParserStateMachine* state_machine );
 static void generate_cxx_lexer_state_machine( const LexerStateMachine* lexer_state_machine, const char* prefix );
+static void generate_cxx_table( const int* table, int size, int columns, const char* name );
 static string sanitize( const char* input );
+static bool is_cxx_keyword( const char* identifier );
 
 int main( int argc, char** argv )
 {
     string input;
     string output;
+    string actions;
     bool print = false;
+    bool compress = false;
+    bool statistics = false;
+    bool fold_whitespace = false;
+    int threads = 1;
+    bool timings = false;
     bool help = false;
     bool version = false;
 
@@ -64,11 +101,41 @@ int main( int argc, char** argv )
             output = argv[argi + 1];
             argi += 2;
         }
+        else if ( strcmp(argv[argi], "-a") == 0 || strcmp(argv[argi], "--actions") == 0 )
+        {
+            actions = argv[argi + 1];
+            argi += 2;
+        }
         else if ( strcmp(argv[argi], "-p") == 0 || strcmp(argv[argi], "--print") == 0 )
         {
             print = true;
             argi += 1;
         }
+        else if ( strcmp(argv[argi], "-c") == 0 || strcmp(argv[argi], "--compress") == 0 )
+        {
+            compress = true;
+            argi += 1;
+        }
+        else if ( strcmp(argv[argi], "-s") == 0 || strcmp(argv[argi], "--statistics") == 0 )
+        {
+            statistics = true;
+            argi += 1;
+        }
+        else if ( strcmp(argv[argi], "-w") == 0 || strcmp(argv[argi], "--fold-whitespace") == 0 )
+        {
+            fold_whitespace = true;
+            argi += 1;
+        }
+        else if ( strcmp(argv[argi], "-j") == 0 || strcmp(argv[argi], "--threads") == 0 )
+        {
+            threads = std::max( 0, atoi(argv[argi + 1]) );
+            argi += 2;
+        }
+        else if ( strcmp(argv[argi], "-t") == 0 || strcmp(argv[argi], "--timings") == 0 )
+        {
+            timings = true;
+            argi += 1;
+        }
         else if ( strcmp(argv[argi], "-h") == 0 || strcmp(argv[argi], "--help") == 0 )
         {
             help = true;
@@ -93,59 +160,76 @@ int main( int argc, char** argv )
         printf( "-h|--help     Display this help message\n" );
         printf( "-v|--version  Display version\n" );
         printf( "-p|--print    Print parser state machine\n" );
+        printf( "-c|--compress Generate compressed rather than dense parse tables\n" );
+        printf( "-s|--statistics Print the size of each parse table format\n" );
+        printf( "-w|--fold-whitespace Skip whitespace in the main lexer state machine\n" );
+        printf( "-j|--threads  Number of threads to compile with or 0 for one per hardware thread\n" );
+        printf( "-t|--timings  Print the time taken by each phase of compilation to stderr\n" );
         printf( "-o|--output   Output file\n" );
+        printf( "-a|--actions  Write a header declaring the grammar's actions for StaticParser (and the parser if -o is given)\n" );
         printf( "\n" );
         return help ? EXIT_SUCCESS : EXIT_FAILURE;
     }
 
     if ( !input.empty() )
     {
-        struct stat stat;
-        int result = ::stat( input.c_str(), &stat );
-        if ( result != 0 )
+        MappedFile grammar_source;
+        if ( !grammar_source.open(input.c_str()) )
         {
-            error( "Stat failed on '%s' - result=%d\n", input.c_str(), result );
+            error( "Opening '%s' to read failed - errno=%d\n", input.c_str(), errno );
             return EXIT_FAILURE;
         }
 
-        FILE* file = fopen( input.c_str(), "rb" );
-        if ( !file )
+        GrammarCompiler compiler;
+        compiler.set_whitespace_folding_enabled( fold_whitespace );
+        LalrcErrorPolicy error_policy( statistics );
+        int errors = compiler.compile( grammar_source.begin(), grammar_source.end(), &error_policy, threads );
+        if ( timings )
         {
-            error( "Opening '%s' to read failed - errno=%d\n", input.c_str(), errno );
-            return EXIT_FAILURE;
+            fprintf( stderr, "parse            %8.3f ms\n", compiler.parse_time() * 1000.0 );
+            fprintf( stderr, "symbols          %8.3f ms\n", compiler.symbols_time() * 1000.0 );
+            fprintf( stderr, "parser           %8.3f ms\n", compiler.parser_time() * 1000.0 );
+            fprintf( stderr, "lexer            %8.3f ms\n", compiler.lexer_time() * 1000.0 );
+            fprintf( stderr, "whitespace lexer %8.3f ms\n", compiler.whitespace_lexer_time() * 1000.0 );
+            fprintf( stderr, "compile          %8.3f ms\n", compiler.compile_time() * 1000.0 );
         }
-
-        int size = stat.st_size;
-        vector<char> grammar_source;
-        grammar_source.resize( size );
-        int read = int( fread(&grammar_source[0], sizeof(uint8_t), size, file) );
-        fclose( file );
-        file = nullptr;
-        if ( read != size )
+        if ( errors != 0 )            
         {
-            error( "Reading grammar from '%s' failed - read=%d\n", input.c_str(), int(read) );
             return EXIT_FAILURE;
         }
 
-        GrammarCompiler compiler;
-        ErrorPolicy error_policy;
-        int errors = compiler.compile( &grammar_source[0], &grammar_source[0] + grammar_source.size(), &error_policy );
-        if ( errors != 0 )            
+        const ParserStateMachine* state_machine = compiler.parser_state_machine();
+        if ( !actions.empty() && !check_cxx_parser_actions(state_machine) )
         {
             return EXIT_FAILURE;
         }
 
-        const ParserStateMachine* state_machine = compiler.parser_state_machine();
-        open( !output.empty() ? output.c_str() : nullptr );
-        if ( print )
+        // The parser state machine is written to stdout when there is no 
+        // output file unless only the actions header has been asked for.
+        if ( !output.empty() || actions.empty() || print || statistics )
         {
-            print_cxx_parser_state_machine( state_machine );
+            open( !output.empty() ? output.c_str() : nullptr );
+            if ( print )
+            {
+                print_cxx_parser_state_machine( state_machine );
+            }
+            else if ( statistics )
+            {
+                statistics_cxx_parser_state_machine( state_machine );
+            }
+            else
+            {
+                generate_cxx_parser_state_machine( state_machine, compress );
+            }
+            close();
         }
-        else
+
+        if ( !actions.empty() )
         {
-            generate_cxx_parser_state_machine( state_machine );
+            open( actions.c_str() );
+            generate_cxx_parser_actions( state_machine );
+            close();
         }
-        close();
     }
 
     return errors_ == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
@@ -208,7 +292,7 @@ void print_cxx_parser_state_machine( const ParserStateMachine* state_machine )
     const ParserState* states_end = states + state_machine->states_size;
     for ( const ParserState* state = states; state != states_end; ++state )
     {
-        write( "state %d:\n", state->index );
+        write( "state %d:%s\n", state->index, state->default_transition ? " (default reduce)" : "" );
         const ParserTransition* transitions = state->transitions;
         const ParserTransition* transitions_end = transitions + state->length;
         for ( const ParserTransition* transition = transitions; transition != transitions_end; ++transition )
@@ -226,7 +310,22 @@ void print_cxx_parser_state_machine( const ParserStateMachine* state_machine )
     }
 }
 
-void generate_cxx_parser_state_machine( const ParserStateMachine* state_machine )
+void statistics_cxx_parser_state_machine( const ParserStateMachine* state_machine )
+{
+    int states_size = state_machine->states_size;
+    int symbols_size = state_machine->symbols_size;
+    int transitions_size = state_machine->transitions_size;
+    int compressed_table_size = state_machine->compressed_table_size;
+    size_t transitions_bytes = transitions_size * sizeof(ParserTransition) + states_size * sizeof(ParserState);
+    size_t dense_bytes = 2 * states_size * symbols_size * sizeof(int);
+    size_t compressed_bytes = (2 * states_size + 2 * compressed_table_size) * sizeof(int);
+    write( "%d states, %d symbols, %d transitions\n", states_size, symbols_size, transitions_size );
+    write( "transitions: %d bytes\n", int(transitions_bytes) );
+    write( "dense tables: %d bytes\n", int(dense_bytes) );
+    write( "compressed tables: %d bytes (%d entries)\n", int(compressed_bytes), compressed_table_size );
+}
+
+void generate_cxx_parser_state_machine( const ParserStateMachine* state_machine, bool compress )
 {
     write( "\n" );
     write( "#include <lalr/ParserStateMachine.hpp>\n" );
@@ -237,6 +336,7 @@ void generate_cxx_parser_state_machine( const ParserStateMachine* state_machine
     write( "#include <lalr/LexerStateMachine.hpp>\n" );
     write( "#include <lalr/LexerState.hpp>\n" );
     write( "#include <lalr/LexerTransition.hpp>\n" );
+    write( "#include <lalr/LexerLoop.hpp>\n" );
     write( "#include <lalr/LexerAction.hpp>\n" );
     write( "\n" );
     write( "using namespace lalr;\n" );
@@ -254,6 +354,13 @@ void generate_cxx_parser_state_machine( const ParserStateMachine* state_machine
     write( "extern const ParserSymbol symbols [];\n" );
     write( "extern const ParserTransition transitions [];\n" );
     write( "extern const ParserState states [];\n" );
+    write( "extern const int action_table [];\n" );
+    write( "extern const int goto_table [];\n" );
+    write( "extern const int default_table [];\n" );
+    write( "extern const int base_table [];\n" );
+    write( "extern const int next_table [];\n" );
+    write( "extern const int check_table [];\n" );
+    write( "extern const ParserStateMachine parser_state_machine;\n" );
     write( "\n" );
 
     write( "const ParserAction actions [] = \n" );
@@ -329,16 +436,39 @@ void generate_cxx_parser_state_machine( const ParserStateMachine* state_machine
     const ParserState* states_end = states + state_machine->states_size;
     for ( const ParserState* state = states; state != states_end; ++state )
     {
-        write( "    {%d, %d, &transitions[%d]},\n",
+        write( "    {%d, %d, &transitions[%d], ",
             state->index,
             state->length,
             state->transitions->index 
         );
+        if ( state->default_transition )
+        {
+            write( "&transitions[%d]},\n", state->default_transition->index );
+        }
+        else
+        {
+            write( "nullptr},\n" );
+        }
     }
-    write( "    {-1, 0, nullptr}\n" );
+    write( "    {-1, 0, nullptr, nullptr}\n" );
     write( "};\n" );
     write( "\n" );
 
+    const int* action_table = !compress ? state_machine->action_table : nullptr;
+    const int* goto_table = !compress ? state_machine->goto_table : nullptr;
+    const int* default_table = compress ? state_machine->default_table : nullptr;
+    const int* base_table = compress ? state_machine->base_table : nullptr;
+    const int* next_table = compress ? state_machine->next_table : nullptr;
+    const int* check_table = compress ? state_machine->check_table : nullptr;
+    int tables_size = state_machine->states_size * state_machine->symbols_size;
+    int compressed_table_size = compress && base_table ? state_machine->compressed_table_size : 0;
+    generate_cxx_table( action_table, tables_size, state_machine->symbols_size, "action_table" );
+    generate_cxx_table( goto_table, tables_size, state_machine->symbols_size, "goto_table" );
+    generate_cxx_table( default_table, state_machine->states_size, 16, "default_table" );
+    generate_cxx_table( base_table, state_machine->states_size, 16, "base_table" );
+    generate_cxx_table( next_table, compressed_table_size, 16, "next_table" );
+    generate_cxx_table( check_table, compressed_table_size, 16, "check_table" );
+
     generate_cxx_lexer_state_machine( state_machine->lexer_state_machine, "lexer" );
     generate_cxx_lexer_state_machine( state_machine->whitespace_lexer_state_machine, "whitespace_lexer" );
 
@@ -357,8 +487,15 @@ void generate_cxx_parser_state_machine( const ParserStateMachine* state_machine
     write( "    &symbols[%d], // end symbol\n", state_machine->end_symbol->index );
     write( "    &symbols[%d], // error symbol\n", state_machine->error_symbol->index );
     write( "    &states[%d], // start state\n", state_machine->start_state->index );
-    write( "    %s, // lexer state machine\n", state_machine->lexer_state_machine ? "&lexer_state_machine" : "null" );
-    write( "    %s // whitespace lexer state machine\n", state_machine->whitespace_lexer_state_machine ? "&whitespace_lexer_state_machine" : "null" );
+    write( "    %s, // lexer state machine\n", state_machine->lexer_state_machine ? "&lexer_state_machine" : "nullptr" );
+    write( "    %s, // whitespace lexer state machine\n", state_machine->whitespace_lexer_state_machine ? "&whitespace_lexer_state_machine" : "nullptr" );
+    write( "    %s, // action table\n", action_table ? "action_table" : "nullptr" );
+    write( "    %s, // goto table\n", goto_table ? "goto_table" : "nullptr" );
+    write( "    %d, // #compressed table entries\n", compressed_table_size );
+    write( "    %s, // default table\n", default_table ? "default_table" : "nullptr" );
+    write( "    %s, // base table\n", base_table ? "base_table" : "nullptr" );
+    write( "    %s, // next table\n", next_table ? "next_table" : "nullptr" );
+    write( "    %s // check table\n", check_table ? "check_table" : "nullptr" );
     write( "};\n" );
 
     write( "\n" );
@@ -369,6 +506,75 @@ void generate_cxx_parser_state_machine( const ParserStateMachine* state_machine
     write( "\n" );
 }
 
+bool check_cxx_parser_actions( const ParserStateMachine* state_machine )
+{
+    bool valid = true;
+    const ParserAction* actions = state_machine->actions;
+    const ParserAction* actions_end = actions + state_machine->actions_size;
+    for ( const ParserAction* action = actions; action != actions_end; ++action )
+    {
+        if ( is_cxx_keyword(action->identifier) )
+        {
+            error( "Action '%s' in grammar '%s' is a C++ keyword so can't be named in the actions header\n", action->identifier, state_machine->identifier );
+            valid = false;
+        }
+    }
+    return valid;
+}
+
+void generate_cxx_parser_actions( const ParserStateMachine* state_machine )
+{
+    string identifier = state_machine->identifier;
+    string guard;
+    for ( string::const_iterator i = identifier.begin(); i != identifier.end(); ++i )
+    {
+        guard.push_back( char(toupper(*i)) );
+    }
+
+    write( "#ifndef %s_ACTIONS_HPP_INCLUDED\n", guard.c_str() );
+    write( "#define %s_ACTIONS_HPP_INCLUDED\n", guard.c_str() );
+    write( "\n" );
+    write( "#include <stddef.h>\n" );
+    write( "\n" );
+    write( "namespace lalr\n" );
+    write( "{\n" );
+    write( "class ParserStateMachine;\n" );
+    write( "}\n" );
+    write( "\n" );
+    write( "extern const lalr::ParserStateMachine* %s_parser_state_machine;\n", identifier.c_str() );
+    write( "\n" );
+
+    write( "enum class %s_action : int\n", identifier.c_str() );
+    write( "{\n" );
+    const ParserAction* actions = state_machine->actions;
+    const ParserAction* actions_end = actions + state_machine->actions_size;
+    for ( const ParserAction* action = actions; action != actions_end; ++action )
+    {
+        write( "    %s = %d,\n", action->identifier, action->index );
+    }
+    write( "};\n" );
+    write( "\n" );
+
+    write( "struct %s_actions\n", identifier.c_str() );
+    write( "{\n" );
+    write( "    template <class UserData, class Handler, class ParserNode>\n" );
+    write( "    static UserData reduce( Handler* handler, int action, UserData* data, const ParserNode* nodes, size_t length )\n" );
+    write( "    {\n" );
+    write( "        switch ( %s_action(action) )\n", identifier.c_str() );
+    write( "        {\n" );
+    for ( const ParserAction* action = actions; action != actions_end; ++action )
+    {
+        write( "            case %s_action::%s:\n", identifier.c_str(), action->identifier );
+        write( "                return handler->%s( data, nodes, length );\n", action->identifier );
+    }
+    write( "        }\n" );
+    write( "        return UserData();\n" );
+    write( "    }\n" );
+    write( "};\n" );
+    write( "\n" );
+    write( "#endif\n" );
+}
+
 void generate_cxx_lexer_state_machine( const LexerStateMachine* state_machine, const char* prefix )
 {
     if ( state_machine )
@@ -413,6 +619,31 @@ void generate_cxx_lexer_state_machine( const LexerStateMachine* state_machine, c
         write( "};\n" );
         write( "\n" );
 
+        if ( state_machine->loops_size > 0 )
+        {
+            write( "const LexerLoop %s_loops [] = \n", prefix );
+            write( "{\n" );
+            const LexerLoop* loops = state_machine->loops;
+            const LexerLoop* loops_end = loops + state_machine->loops_size;
+            for ( const LexerLoop* loop = loops; loop != loops_end; ++loop )
+            {
+                write( "    {{" );
+                for ( int i = 0; i < LexerLoop::CHARACTERS / 8; ++i )
+                {
+                    write( i > 0 ? ", %d" : "%d", loop->characters[i] );
+                }
+                write( "}, %d, {", loop->ranges_size );
+                for ( int i = 0; i < LexerLoop::RANGES * 2; ++i )
+                {
+                    write( i > 0 ? ", %d" : "%d", loop->ranges[i] );
+                }
+                write( "}},\n" );
+            }
+            write( "    {{0}, 0, {0}}\n" );
+            write( "};\n" );
+            write( "\n" );
+        }
+
         write( "const LexerState %s_states [] = \n", prefix );
         write( "{\n" );
         const LexerState* states = state_machine->states;
@@ -426,19 +657,52 @@ void generate_cxx_lexer_state_machine( const LexerStateMachine* state_machine, c
                 int(state->transitions - state_machine->transitions)
             );
             const ParserSymbol* symbol = reinterpret_cast<const ParserSymbol*>( state->symbol );
-            if ( symbol )
+            if ( symbol && symbol == state_machine->skip_symbol )
+            {
+                write( "&parser_state_machine, " );
+            }
+            else if ( symbol )
             {
-                write( "&symbols[%d]},\n", symbol->index );
+                write( "&symbols[%d], ", symbol->index );
+            }
+            else
+            {
+                write( "nullptr, " );
+            }
+            if ( state->loop )
+            {
+                write( "&%s_loops[%d]},\n", prefix, int(state->loop - state_machine->loops) );
             }
             else
             {
                 write( "nullptr},\n" );
             }
         }
-        write( "    {-1, 0, nullptr, nullptr}\n" );
+        write( "    {-1, 0, nullptr, nullptr, nullptr}\n" );
         write( "};\n" );
         write( "\n" );
 
+        string character_classes = string( prefix ) + "_character_classes";
+        string transition_table = string( prefix ) + "_transition_table";
+        if ( state_machine->character_classes )
+        {
+            write( "const unsigned char %s [] = \n", character_classes.c_str() );
+            write( "{\n" );
+            for ( int row = 0; row < 256; row += 16 )
+            {
+                write( "   " );
+                for ( int column = row; column < row + 16; ++column )
+                {
+                    write( " %d,", state_machine->character_classes[column] );
+                }
+                write( "\n" );
+            }
+            write( "    0\n" );
+            write( "};\n" );
+            write( "\n" );
+        }
+        generate_cxx_table( state_machine->transition_table, state_machine->states_size * state_machine->classes_size, state_machine->classes_size, transition_table.c_str() );
+
         write( "const LexerStateMachine %s_state_machine = \n", prefix );
         write( "{\n" );
         write( "    %d, // #actions\n", state_machine->actions_size );
@@ -447,7 +711,34 @@ void generate_cxx_lexer_state_machine( const LexerStateMachine* state_machine, c
         write( "    %s_actions, // actions\n", prefix );
         write( "    %s_transitions, // transitions\n", prefix );
         write( "    %s_states, // states\n", prefix );
-        write( "    &%s_states[%d] // start state\n", prefix, state_machine->start_state->index );
+        write( "    &%s_states[%d], // start state\n", prefix, state_machine->start_state->index );
+        write( "    %d, // #classes\n", state_machine->classes_size );
+        write( "    %s, // character classes\n", state_machine->character_classes ? character_classes.c_str() : "nullptr" );
+        write( "    %s, // transition table\n", state_machine->transition_table ? transition_table.c_str() : "nullptr" );
+        write( "    %s, // skip symbol\n", state_machine->skip_symbol ? "&parser_state_machine" : "nullptr" );
+        write( "    %d, // #loops\n", state_machine->loops_size );
+        write( "    %s // loops\n", state_machine->loops_size > 0 ? (string(prefix) + "_loops").c_str() : "nullptr" );
+        write( "};\n" );
+        write( "\n" );
+    }
+}
+
+void generate_cxx_table( const int* table, int size, int columns, const char* name )
+{
+    if ( table )
+    {
+        write( "const int %s [] = \n", name );
+        write( "{\n" );
+        for ( int row = 0; row < size; row += columns )
+        {
+            write( "   " );
+            for ( int column = row; column < row + columns && column < size; ++column )
+            {
+                write( " %d,", table[column] );
+            }
+            write( "\n" );
+        }
+        write( "    0\n" );
         write( "};\n" );
         write( "\n" );
     }
@@ -471,3 +762,33 @@ string sanitize( const char* input )
     }
     return output;
 }
+
+bool is_cxx_keyword( const char* identifier )
+{
+    static const char* keywords [] =
+    {
+        "alignas", "alignof", "and", "and_eq", "asm", "auto",
+        "bitand", "bitor", "bool", "break", "case", "catch",
+        "char", "char16_t", "char32_t", "class", "compl", "const",
+        "constexpr", "const_cast", "continue", "decltype", "default", "delete",
+        "do", "double", "dynamic_cast", "else", "enum", "explicit",
+        "export", "extern", "false", "float", "for", "friend",
+        "goto", "if", "inline", "int", "long", "mutable",
+        "namespace", "new", "noexcept", "not", "not_eq", "nullptr",
+        "operator", "or", "or_eq", "private", "protected", "public",
+        "register", "reinterpret_cast", "return", "short", "signed", "sizeof",
+        "static", "static_assert", "static_cast", "struct", "switch", "template",
+        "this", "thread_local", "throw", "true", "try", "typedef",
+        "typeid", "typename", "union", "unsigned", "using", "virtual",
+        "void", "volatile", "wchar_t", "while", "xor", "xor_eq"
+    };
+    const char** keywords_end = keywords + sizeof(keywords) / sizeof(keywords[0]);
+    for ( const char** keyword = keywords; keyword != keywords_end; ++keyword )
+    {
+        if ( strcmp(identifier, *keyword) == 0 )
+        {
+            return true;
+        }
+    }
+    return false;
+}